@@ -0,0 +1,101 @@
+/*
+  ==============================================================================
+
+   This file is part of the GrandStaffMIDIVisualizer plugin code.
+   Copyright (c) Brynjar Reynisson
+
+   The code included in this file is provided under the terms of the ISC license
+   http://www.isc.org/downloads/software-support-policy/isc-license. Permission
+   to use, copy, modify, and/or distribute this software for any purpose with or
+   without fee is hereby granted provided that the above copyright notice and
+   this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+   REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+   AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+   INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+   LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+   OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+   PERFORMANCE OF THIS SOFTWARE.
+
+  ==============================================================================
+*/
+
+#include "MainComponent.h"
+#include <limits>
+
+bool AccidentalStacking::getAccidental(int midiNote, const NoteDrawInfo& noteDrawInfo, float noteHeight, Accidental& accidental)
+{
+    //the same boxes NotationLayout::build places the glyphs within, relative to the top of the note head
+    float top;
+    float height = noteHeight * 2.5f;
+    if (noteDrawInfo.sharp || noteDrawInfo.natural)
+        top = noteDrawInfo.y - noteHeight * 0.75f;
+    else if (noteDrawInfo.flat || noteDrawInfo.doubleFlat)
+        top = noteDrawInfo.y - noteHeight * 1.25f;
+    else if (noteDrawInfo.doubleSharp)
+    {
+        top = noteDrawInfo.y;
+        height = noteHeight;
+    }
+    else
+        return false;
+
+    accidental.midiNote = midiNote;
+    accidental.top = top;
+    accidental.bottom = top + height;
+    accidental.column = 0;
+    return true;
+}
+
+int AccidentalStacking::stack(Accidental* accidentals, int numAccidentals)
+{
+    //higher notes are higher up, except where an ottava pulls a note back onto the staff
+    std::sort(accidentals, accidentals + numAccidentals, [](const Accidental& a, const Accidental& b)
+        {
+            return a.top != b.top ? a.top < b.top : a.midiNote > b.midiNote;
+        });
+
+    /*
+    * Working from the outside in, everything already placed from the top is above the next accidental
+    * and everything placed from the bottom is below it. So each column only needs to know how far down the top ones
+    * reach and how far up the bottom ones reach, which keeps this linear in the number of accidentals.
+    * Boxes that only touch may share a column, that's accidentals a sixth apart.
+    */
+    float topReach[maxColumns];
+    float bottomReach[maxColumns];
+    int numColumns = 0;
+
+    int first = 0;
+    int last = numAccidentals - 1;
+    bool fromTop = true;
+    while (first <= last)
+    {
+        Accidental& accidental = fromTop ? accidentals[first++] : accidentals[last--];
+
+        int column = 0;
+        while (column < numColumns &&
+            (accidental.top < topReach[column] || accidental.bottom > bottomReach[column]))
+            column++;
+
+        if (column == maxColumns)
+        {
+            //out of room, let it overlap in the outermost column
+            column = maxColumns - 1;
+        }
+        else if (column == numColumns)
+        {
+            topReach[column] = -std::numeric_limits<float>::max();
+            bottomReach[column] = std::numeric_limits<float>::max();
+            numColumns++;
+        }
+
+        accidental.column = column;
+        if (fromTop)
+            topReach[column] = std::max(topReach[column], accidental.bottom);
+        else
+            bottomReach[column] = std::min(bottomReach[column], accidental.top);
+        fromTop = !fromTop;
+    }
+    return numColumns;
+}
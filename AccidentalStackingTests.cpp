@@ -0,0 +1,158 @@
+/*
+  ==============================================================================
+
+   This file is part of the GrandStaffMIDIVisualizer plugin code.
+   Copyright (c) Brynjar Reynisson
+
+   The code included in this file is provided under the terms of the ISC license
+   http://www.isc.org/downloads/software-support-policy/isc-license. Permission
+   to use, copy, modify, and/or distribute this software for any purpose with or
+   without fee is hereby granted provided that the above copyright notice and
+   this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+   REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+   AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+   INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+   LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+   OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+   PERFORMANCE OF THIS SOFTWARE.
+
+  ==============================================================================
+*/
+
+#include "MainComponent.h"
+
+#if JUCE_UNIT_TESTS
+
+class AccidentalStackingTests final : public UnitTest
+{
+public:
+    AccidentalStackingTests() : UnitTest("AccidentalStacking", "GrandStaffMIDIVisualizer") {}
+
+    void runTest() override
+    {
+        beginTest("Clusters of up to 12 accidentals on neighbouring steps don't overlap within a column");
+        //every subset of 12 neighbouring steps, with each glyph alone and a few random mixes of them
+        Random random = getRandom();
+        int numStacks = 0;
+        int numFailures = 0;
+        for (int subset = 1; subset < (1 << maxAccidentals); subset++)
+        {
+            for (int mix = 0; mix < numGlyphKinds + numRandomMixes; mix++)
+            {
+                NoteDrawInfo noteDrawInfos[maxAccidentals];
+                int steps[maxAccidentals];
+                int numNotes = 0;
+                for (int step = 0; step < maxAccidentals; step++)
+                {
+                    if ((subset >> step) & 1)
+                    {
+                        steps[numNotes] = step;
+                        setGlyph(noteDrawInfos[numNotes], mix < numGlyphKinds ? mix : random.nextInt(numGlyphKinds));
+                        numNotes++;
+                    }
+                }
+                numFailures += checkStack(noteDrawInfos, steps, numNotes) ? 0 : 1;
+                numStacks++;
+            }
+        }
+        expectEquals(numFailures, 0, "failed stacks out of " + String(numStacks));
+
+        beginTest("Columns go outside in, alternating between the top and the bottom");
+        for (int numAccidentals = 1; numAccidentals <= maxAccidentals; numAccidentals++)
+        {
+            //all the boxes overlap each other, so each one gets a column of its own in the order they're placed
+            AccidentalStacking::Accidental accidentals[maxAccidentals];
+            for (int i = 0; i < numAccidentals; i++)
+            {
+                accidentals[i].midiNote = 100 - i;
+                accidentals[i].top = (float)i;
+                accidentals[i].bottom = (float)(i + maxAccidentals * 2);
+            }
+            int numColumns = AccidentalStacking::stack(accidentals, numAccidentals);
+            expectEquals(numColumns, numAccidentals);
+
+            //the top one first, then the bottom one, then the second from the top and so on
+            bool zigZag = true;
+            for (int i = 0; i < numAccidentals; i++)
+            {
+                int fromBottom = numAccidentals - 1 - i;
+                int expectedColumn = i <= fromBottom ? i * 2 : fromBottom * 2 + 1;
+                zigZag = zigZag && accidentals[i].column == expectedColumn;
+            }
+            expect(zigZag, "zig-zag order with " + String(numAccidentals) + " accidentals");
+        }
+
+        beginTest("Accidentals far enough apart share the column next to the notes");
+        AccidentalStacking::Accidental apart[maxAccidentals];
+        for (int i = 0; i < maxAccidentals; i++)
+        {
+            apart[i].top = i * 10.0f;
+            apart[i].bottom = i * 10.0f + 10.0f; //touching is fine
+        }
+        expectEquals(AccidentalStacking::stack(apart, maxAccidentals), 1);
+
+        beginTest("Accidentals are sorted before stacking");
+        AccidentalStacking::Accidental reversed[maxAccidentals];
+        for (int i = 0; i < maxAccidentals; i++)
+        {
+            reversed[i].midiNote = 100 - (maxAccidentals - 1 - i);
+            reversed[i].top = (float)(maxAccidentals - 1 - i);
+            reversed[i].bottom = reversed[i].top + maxAccidentals * 2;
+        }
+        AccidentalStacking::stack(reversed, maxAccidentals);
+        bool sorted = true;
+        for (int i = 0; i < maxAccidentals; i++)
+            sorted = sorted && reversed[i].top == (float)i && reversed[i].column == (i <= maxAccidentals - 1 - i ? i * 2 : (maxAccidentals - 1 - i) * 2 + 1);
+        expect(sorted, "reversed input gets the same columns as sorted input");
+    }
+
+private:
+    static constexpr int maxAccidentals = 12;
+    static constexpr int numGlyphKinds = 5;
+    static constexpr int numRandomMixes = 4;
+    static constexpr float noteHeight = 20.0f;
+
+    static void setGlyph(NoteDrawInfo& noteDrawInfo, int kind)
+    {
+        noteDrawInfo.sharp = kind == 0;
+        noteDrawInfo.flat = kind == 1;
+        noteDrawInfo.natural = kind == 2;
+        noteDrawInfo.doubleSharp = kind == 3;
+        noteDrawInfo.doubleFlat = kind == 4;
+    }
+
+    //lays the notes out a diatonic step apart, the narrowest the staff gets, and stacks them the way NotationLayout does
+    bool checkStack(NoteDrawInfo* noteDrawInfos, const int* steps, int numNotes)
+    {
+        float halfStep = 0.5f * noteHeight * 0.97f;
+        AccidentalStacking::Accidental accidentals[maxAccidentals];
+        for (int i = 0; i < numNotes; i++)
+        {
+            noteDrawInfos[i].y = (maxAccidentals - steps[i]) * halfStep;
+            AccidentalStacking::getAccidental(60 + steps[i], noteDrawInfos[i], noteHeight, accidentals[i]);
+        }
+        int numColumns = AccidentalStacking::stack(accidentals, numNotes);
+        if (numColumns < 1 || numColumns > AccidentalStacking::maxColumns || numColumns > numNotes)
+            return false;
+
+        for (int i = 0; i < numNotes; i++)
+        {
+            if (accidentals[i].column < 0 || accidentals[i].column >= numColumns)
+                return false;
+            for (int j = i + 1; j < numNotes; j++)
+            {
+                //boxes that only touch may share a column
+                bool overlap = accidentals[i].top < accidentals[j].bottom && accidentals[j].top < accidentals[i].bottom;
+                if (overlap && accidentals[i].column == accidentals[j].column)
+                    return false;
+            }
+        }
+        return true;
+    }
+};
+
+static AccidentalStackingTests accidentalStackingTests;
+
+#endif
@@ -23,1048 +23,1125 @@
 
 #include "MainComponent.h"
 
-Chords::Chords()
+/*
+* The chord dictionary and the lookup tables derived from it are all evaluated at compile time,
+* so they live in read-only memory and are shared by every plugin instance
+*/
+static constexpr ChordPattern patternList[] =
 {
-	std::vector<ChordPattern> patternList
+	//intervals
+	ChordPattern("100000100000", " tritone", L" tritone", Tritonic),
+	ChordPattern("100000010000", "5", L"5", Major),
+	//major
+	ChordPattern("100010010000", "", L"", Major),
+	ChordPattern("100010010100", "6", L"6", Major),
+	ChordPattern("100010010010", "7", L"7", Major),
+	ChordPattern("101010010010", "9", L"9", Major),
+	ChordPattern("101011010010", "11", L"11", Major),
+	ChordPattern("101011010110", "13", L"13", Major),
+	ChordPattern("100010110100", "(#11,13)", L"(#11,13)", Major),
+	ChordPattern("100010111000", "(#11,b13)", L"(#11,b13)", Major),
+	ChordPattern("100110110000", "(#9,#11)", L"(#9,#11)", Major),
+	ChordPattern("100110110100", "(#9,#11,13)", L"(#9,#11,13)", Major),
+	ChordPattern("100110111000", "(#9,#11,b13)", L"(#9,#11,b13)", Major),
+	ChordPattern("100111010000", "(#9,11)", L"(#9,11)", Major),
+	ChordPattern("100111010100", "(#9,11,13)", L"(#9,11,13)", Major),
+	ChordPattern("100111011000", "(#9,11,b13)", L"(#9,11,b13)", Major),
+	ChordPattern("100110010100", "(#9,13)", L"(#9,13)", Major),
+	ChordPattern("100110011000", "(#9,b13)", L"(#9,b13)", Major),
+	ChordPattern("100011010100", "(11,13)", L"(11,13)", Major),
+	ChordPattern("100011011000", "(11,b13)", L"(11,b13)", Major),
+	ChordPattern("101010110000", "(9,#11)", L"(9,#11)", Major),
+	ChordPattern("101010110100", "(9,#11,13)", L"(9,#11,13)", Major),
+	ChordPattern("101010111000", "(9,#11,b13)", L"(9,#11,b13)", Major),
+	ChordPattern("101011010000", "(9,11)", L"(9,11)", Major),
+	ChordPattern("101011010100", "(9,11,13)", L"(9,11,13)", Major),
+	ChordPattern("101011011000", "(9,11,b13)", L"(9,11,b13)", Major),
+	ChordPattern("101010010100", "(9,13)", L"(9,13)", Major),
+	ChordPattern("101010011000", "(9,b13)", L"(9,b13)", Major),
+	ChordPattern("100010110000", "(add#11)", L"(add#11)", Major),
+	ChordPattern("100110010000", "(add#9)", L"(add#9)", Major),
+	ChordPattern("100011010000", "(add11)", L"(add11)", Major),
+	ChordPattern("101010010000", "(add9)", L"(add9)", Major),
+	ChordPattern("100010011000", "(addb13)", L"(addb13)", Major),
+	ChordPattern("110010010000", "(addb9)", L"(addb9)", Major),
+	ChordPattern("100010100000", "(b5)", L"(b5)", Major),
+	ChordPattern("100110100000", "(b5,#9)", L"(b5,#9)", Major),
+	ChordPattern("100111100000", "(b5,#9,11)", L"(b5,#9,11)", Major),
+	ChordPattern("100111100100", "(b5,#9,11,13)", L"(b5,#9,11,13)", Major),
+	ChordPattern("100111101000", "(b5,#9,11,b13)", L"(b5,#9,11,b13)", Major),
+	ChordPattern("100110100100", "(b5,#9,13)", L"(b5,#9,13)", Major),
+	ChordPattern("100011100000", "(b5,11)", L"(b5,11)", Major),
+	ChordPattern("100011100100", "(b5,11,13)", L"(b5,11,13)", Major),
+	ChordPattern("100011101000", "(b5,11,b13)", L"(b5,11,b13)", Major),
+	ChordPattern("100010100100", "(b5,13)", L"(b5,13)", Major),
+	ChordPattern("101010100000", "(b5,9)", L"(b5,9)", Major),
+	ChordPattern("101011100000", "(b5,9,11)", L"(b5,9,11)", Major),
+	ChordPattern("101011100100", "(b5,9,11,13)", L"(b5,9,11,13)", Major),
+	ChordPattern("101011101000", "(b5,9,11,b13)", L"(b5,9,11,b13)", Major),
+	ChordPattern("101010100100", "(b5,9,13)", L"(b5,9,13)", Major),
+	ChordPattern("110010100000", "(b5,b9)", L"(b5,b9)", Major),
+	ChordPattern("110011100000", "(b5,b9,11)", L"(b5,b9,11)", Major),
+	ChordPattern("110011100100", "(b5,b9,11,13)", L"(b5,b9,11,13)", Major),
+	ChordPattern("110011101000", "(b5,b9,11,b13)", L"(b5,b9,11,b13)", Major),
+	ChordPattern("110010100100", "(b5,b9,13)", L"(b5,b9,13)", Major),
+	ChordPattern("110010110000", "(b9,#11)", L"(b9,#11)", Major),
+	ChordPattern("110010110100", "(b9,#11,13)", L"(b9,#11,13)", Major),
+	ChordPattern("110010111000", "(b9,#11,b13)", L"(b9,#11,b13)", Major),
+	ChordPattern("110110010000", "(b9,#9)", L"(b9,#9)", Major),
+	ChordPattern("110110110000", "(b9,#9,#11)", L"(b9,#9,#11)", Major),
+	ChordPattern("110110110100", "(b9,#9,#11,13)", L"(b9,#9,#11,13)", Major),
+	ChordPattern("110110111000", "(b9,#9,#11,b13)", L"alt", Major),
+	ChordPattern("110111010000", "(b9,#9,11)", L"(b9,#9,11)", Major),
+	ChordPattern("110111010100", "(b9,#9,11,13)", L"(b9,#9,11,13)", Major),
+	ChordPattern("110111011000", "(b9,#9,11,b13)", L"(b9,#9,11,b13)", Major),
+	ChordPattern("110011010000", "(b9,11)", L"(b9,11)", Major),
+	ChordPattern("110011010100", "(b9,11,13)", L"(b9,11,13)", Major),
+	ChordPattern("110011011000", "(b9,11,b13)", L"(b9,11,b13)", Major),
+	ChordPattern("110010010100", "(b9,13)", L"(b9,13)", Major),
+	ChordPattern("110010011000", "(b9,b13)", L"(b9,b13)", Major),
+	ChordPattern("100111010010", "11(#9)", L"11(#9)", Major),
+	ChordPattern("100111011010", "11(#9,b13)", L"11(#9,b13)", Major),
+	ChordPattern("100111011110", "11(6,#9,b13)", L"11(6,#9,b13)", Major),
+	ChordPattern("101011011110", "11(6,b13)", L"11(6,b13)", Major),
+	ChordPattern("101011011010", "11(b13)", L"11(b13)", Major),
+	ChordPattern("101011100010", "11(b5)", L"11(b5)", Major),
+	ChordPattern("100111100010", "11(b5,#9)", L"11(b5,#9)", Major),
+	ChordPattern("100111101010", "11(b5,#9,b13)", L"11(b5,#9,b13)", Major),
+	ChordPattern("100111101110", "11(b5,6,#9,b13)", L"11(b5,6,#9,b13)", Major),
+	ChordPattern("101011101110", "11(b5,6,b13)", L"11(b5,6,b13)", Major),
+	ChordPattern("101011101010", "11(b5,b13)", L"11(b5,b13)", Major),
+	ChordPattern("110011101010", "11(b5,b9,b13)", L"11(b5,b9,b13)", Major),
+	ChordPattern("110011011010", "11(b9,b13)", L"11(b9,b13)", Major),
+	ChordPattern("101010110110", "13(#11)", L"13(#11)", Major),
+	ChordPattern("100111010110", "13(#9)", L"13(#9)", Major),
+	ChordPattern("100110110110", "13(#9,#11)", L"13(#9,#11)", Major),
+	ChordPattern("101011100110", "13(b5)", L"13(b5)", Major),
+	ChordPattern("100111100110", "13(b5,#9)", L"13(b5,#9)", Major),
+	ChordPattern("110011100110", "13(b5,b9)", L"13(b5,b9)", Major),
+	ChordPattern("110011010110", "13(b9)", L"13(b9)", Major),
+	ChordPattern("110010110110", "13(b9,#11)", L"13(b9,#11)", Major),
+	ChordPattern("100010111100", "6(#11,b13)", L"6(#11,b13)", Major),
+	ChordPattern("100110111100", "6(#9,#11,b13)", L"6(#9,#11,b13)", Major),
+	ChordPattern("100111011100", "6(#9,11,b13)", L"6(#9,11,b13)", Major),
+	ChordPattern("100110011100", "6(#9,b13)", L"6(#9,b13)", Major),
+	ChordPattern("100011011100", "6(11,b13)", L"6(11,b13)", Major),
+	ChordPattern("101010111100", "6(9,#11,b13)", L"6(9,#11,b13)", Major),
+	ChordPattern("101011011100", "6(9,11,b13)", L"6(9,11,b13)", Major),
+	ChordPattern("101010011100", "6(9,b13)", L"6(9,b13)", Major),
+	ChordPattern("100010011100", "6(b13)", L"6(b13)", Major),
+	ChordPattern("100111101100", "6(b5,#9,11,b13)", L"6(b5,#9,11,b13)", Major),
+	ChordPattern("100011101100", "6(b5,11,b13)", L"6(b5,11,b13)", Major),
+	ChordPattern("101011101100", "6(b5,9,11,b13)", L"6(b5,9,11,b13)", Major),
+	ChordPattern("110011101100", "6(b5,b9,11,b13)", L"6(b5,b9,11,b13)", Major),
+	ChordPattern("110011011100", "6(b9,11,b13)", L"6(b9,11,b13)", Major),
+	ChordPattern("110010011100", "6(b9,b13)", L"6(b9,b13)", Major),
+	ChordPattern("100010110010", "7(#11)", L"7(#11)", Major),
+	ChordPattern("100010110110", "7(#11,13)", L"7(#11,13)", Major),
+	ChordPattern("100010111010", "7(#11,b13)", L"7(#11,b13)", Major),
+	ChordPattern("100110010010", "7(#9)", L"7(#9)", Major),
+	ChordPattern("100110110010", "7(#9,#11)", L"7(#9,#11)", Major),
+	ChordPattern("100110111010", "7(#9,#11,b13)", L"7(#9,#11,b13)", Major),
+	ChordPattern("100110010110", "7(#9,13)", L"7(#9,13)", Major),
+	ChordPattern("100110011010", "7(#9,b13)", L"7(#9,b13)", Major),
+	ChordPattern("100011010010", "7(11)", L"7(11)", Major),
+	ChordPattern("100011010110", "7(11,13)", L"7(11,13)", Major),
+	ChordPattern("100011011010", "7(11,b13)", L"7(11,b13)", Major),
+	ChordPattern("100010010110", "7(13)", L"7(13)", Major),
+	ChordPattern("100010111110", "7(6,#11,b13)", L"7(6,#11,b13)", Major),
+	ChordPattern("100110111110", "7(6,#9,#11,b13)", L"7(6,#9,#11,b13)", Major),
+	ChordPattern("100110011110", "7(6,#9,b13)", L"7(6,#9,b13)", Major),
+	ChordPattern("100011011110", "7(6,11,b13)", L"7(6,11,b13)", Major),
+	ChordPattern("101010011110", "7(6,9,b13)", L"7(6,9,b13)", Major),
+	ChordPattern("100010011110", "7(6,b13)", L"7(6,b13)", Major),
+	ChordPattern("110010111110", "7(6,b9,#11,b13)", L"7(6,b9,#11,b13)", Major),
+	ChordPattern("100010011010", "7(b13)", L"7(b13)", Major),
+	ChordPattern("100010100010", "7(b5)", L"7(b5)", Major),
+	ChordPattern("100110100010", "7(b5,#9)", L"7(b5,#9)", Major),
+	ChordPattern("100110100110", "7(b5,#9,13)", L"7(b5,#9,13)", Major),
+	ChordPattern("100011100010", "7(b5,11)", L"7(b5,11)", Major),
+	ChordPattern("100011100110", "7(b5,11,13)", L"7(b5,11,13)", Major),
+	ChordPattern("100011101010", "7(b5,11,b13)", L"7(b5,11,b13)", Major),
+	ChordPattern("100010100110", "7(b5,13)", L"7(b5,13)", Major),
+	ChordPattern("100011101110", "7(b5,6,11,b13)", L"7(b5,6,11,b13)", Major),
+	ChordPattern("110010100010", "7(b5,b9)", L"7(b5,b9)", Major),
+	ChordPattern("110011100010", "7(b5,b9,11)", L"7(b5,b9,11)", Major),
+	ChordPattern("110010100110", "7(b5,b9,13)", L"7(b5,b9,13)", Major),
+	ChordPattern("110010010010", "7(b9)", L"7(b9)", Major),
+	ChordPattern("110010110010", "7(b9,#11)", L"7(b9,#11)", Major),
+	ChordPattern("110010111010", "7(b9,#11,b13)", L"7(b9,#11,b13)", Major),
+	ChordPattern("110110010010", "7(b9,#9)", L"7(b9,#9)", Major),
+	ChordPattern("110110110010", "7(b9,#9,#11)", L"7(b9,#9,#11)", Major),
+	ChordPattern("110110110110", "7(b9,#9,#11,13)", L"7(b9,#9,#11,13)", Major),
+	ChordPattern("110110111010", "7(b9,#9,#11,b13)", L"7alt", Major),
+	ChordPattern("110111010010", "7(b9,#9,11)", L"7(b9,#9,11)", Major),
+	ChordPattern("110111010110", "7(b9,#9,11,13)", L"7(b9,#9,11,13)", Major),
+	ChordPattern("110111011010", "7(b9,#9,11,b13)", L"7(b9,#9,11,b13)", Major),
+	ChordPattern("110011010010", "7(b9,11)", L"7(b9,11)", Major),
+	ChordPattern("110010010110", "7(b9,13)", L"7(b9,13)", Major),
+	ChordPattern("110010011010", "7(b9,b13)", L"7(b9,b13)", Major),
+	ChordPattern("101010110010", "9(#11)", L"9(#11)", Major),
+	ChordPattern("101010111010", "9(#11,b13)", L"9(#11,b13)", Major),
+	ChordPattern("101010010110", "9(13)", L"9(13)", Major),
+	ChordPattern("101010111110", "9(6,#11,b13)", L"9(6,#11,b13)", Major),
+	ChordPattern("101010011010", "9(b13)", L"9(b13)", Major),
+	ChordPattern("101010100010", "9(b5)", L"9(b5)", Major),
+	ChordPattern("101010100110", "9(b5,13)", L"9(b5,13)", Major),
+	ChordPattern("101011010001", "M11", L"∆11", Major),
+	ChordPattern("100111010001", "M11(#9)", L"∆11(#9)", Major),
+	ChordPattern("100111011001", "M11(#9,b13)", L"∆11(#9,b13)", Major),
+	ChordPattern("100111011101", "M11(6,#9,b13)", L"∆11(6,#9,b13)", Major),
+	ChordPattern("101011011101", "M11(6,b13)", L"∆11(6,b13)", Major),
+	ChordPattern("110011011101", "M11(6,b9,b13)", L"∆11(6,b9,b13)", Major),
+	ChordPattern("101011011001", "M11(b13)", L"∆11(b13)", Major),
+	ChordPattern("101011100001", "M11(b5)", L"∆11(b5)", Major),
+	ChordPattern("100111100001", "M11(b5,#9)", L"∆11(b5,#9)", Major),
+	ChordPattern("100111101001", "M11(b5,#9,b13)", L"∆11(b5,#9,b13)", Major),
+	ChordPattern("100111101101", "M11(b5,6,#9,b13)", L"∆11(b5,6,#9,b13)", Major),
+	ChordPattern("101011101101", "M11(b5,6,b13)", L"∆11(b5,6,b13)", Major),
+	ChordPattern("110011101101", "M11(b5,6,b9,b13)", L"∆11(b5,6,b9,b13)", Major),
+	ChordPattern("101011101001", "M11(b5,b13)", L"∆11(b5,b13)", Major),
+	ChordPattern("110011101001", "M11(b5,b9,b13)", L"∆11(b5,b9,b13)", Major),
+	ChordPattern("110011011001", "M11(b9,b13)", L"∆11(b9,b13)", Major),
+	ChordPattern("101011010101", "M13", L"∆13", Major),
+	ChordPattern("101010110101", "M13(#11)", L"∆13(#11)", Major),
+	ChordPattern("100111010101", "M13(#9)", L"∆13(#9)", Major),
+	ChordPattern("100110110101", "M13(#9,#11)", L"∆13(#9,#11)", Major),
+	ChordPattern("101011100101", "M13(b5)", L"∆13(b5)", Major),
+	ChordPattern("100111100101", "M13(b5,#9)", L"∆13(b5,#9)", Major),
+	ChordPattern("110011100101", "M13(b5,b9)", L"∆13(b5,b9)", Major),
+	ChordPattern("110011010101", "M13(b9)", L"∆13(b9)", Major),
+	ChordPattern("110010110101", "M13(b9,#11)", L"∆13(b9,#11)", Major),
+	ChordPattern("100010010001", "M7", L"∆", Major),
+	ChordPattern("100010110001", "M7(#11)", L"∆(#11)", Major),
+	ChordPattern("100010110101", "M7(#11,13)", L"∆(#11,13)", Major),
+	ChordPattern("100010111001", "M7(#11,b13)", L"∆(#11,b13)", Major),
+	ChordPattern("100110010001", "M7(#9)", L"∆(#9)", Major),
+	ChordPattern("100110110001", "M7(#9,#11)", L"∆(#9,#11)", Major),
+	ChordPattern("100110111001", "M7(#9,#11,b13)", L"∆(#9,#11,b13)", Major),
+	ChordPattern("100110010101", "M7(#9,13)", L"∆(#9,13)", Major),
+	ChordPattern("100110011001", "M7(#9,b13)", L"∆(#9,b13)", Major),
+	ChordPattern("100011010001", "M7(11)", L"∆(11)", Major),
+	ChordPattern("100011010101", "M7(11,13)", L"∆(11,13)", Major),
+	ChordPattern("100011011001", "M7(11,b13)", L"∆(11,b13)", Major),
+	ChordPattern("100010010101", "M7(13)", L"∆(13)", Major),
+	ChordPattern("100010111101", "M7(6,#11,b13)", L"∆(6,#11,b13)", Major),
+	ChordPattern("100110111101", "M7(6,#9,#11,b13)", L"∆(6,#9,#11,b13)", Major),
+	ChordPattern("100110011101", "M7(6,#9,b13)", L"∆(6,#9,b13)", Major),
+	ChordPattern("100011011101", "M7(6,11,b13)", L"∆(6,11,b13)", Major),
+	ChordPattern("101010011101", "M7(6,9,b13)", L"∆(6,9,b13)", Major),
+	ChordPattern("100010011101", "M7(6,b13)", L"∆(6,b13)", Major),
+	ChordPattern("110010111101", "M7(6,b9,#11,b13)", L"∆(6,b9,#11,b13)", Major),
+	ChordPattern("110010011101", "M7(6,b9,b13)", L"∆(6,b9,b13)", Major),
+	ChordPattern("100010011001", "M7(b13)", L"∆(b13)", Major),
+	ChordPattern("100010100001", "M7(b5)", L"∆(b5)", Major),
+	ChordPattern("100110100001", "M7(b5,#9)", L"∆(b5,#9)", Major),
+	ChordPattern("100110100101", "M7(b5,#9,13)", L"∆(b5,#9,13)", Major),
+	ChordPattern("100011100001", "M7(b5,11)", L"∆(b5,11)", Major),
+	ChordPattern("100011100101", "M7(b5,11,13)", L"∆(b5,11,13)", Major),
+	ChordPattern("100011101001", "M7(b5,11,b13)", L"∆(b5,11,b13)", Major),
+	ChordPattern("100010100101", "M7(b5,13)", L"∆(b5,13)", Major),
+	ChordPattern("100011101101", "M7(b5,6,11,b13)", L"∆(b5,6,11,b13)", Major),
+	ChordPattern("110010100001", "M7(b5,b9)", L"∆(b5,b9)", Major),
+	ChordPattern("110011100001", "M7(b5,b9,11)", L"∆(b5,b9,11)", Major),
+	ChordPattern("110010100101", "M7(b5,b9,13)", L"∆(b5,b9,13)", Major),
+	ChordPattern("110010010001", "M7(b9)", L"∆(b9)", Major),
+	ChordPattern("110010110001", "M7(b9,#11)", L"∆(b9,#11)", Major),
+	ChordPattern("110010111001", "M7(b9,#11,b13)", L"∆(b9,#11,b13)", Major),
+	ChordPattern("110110010001", "M7(b9,#9)", L"∆(b9,#9)", Major),
+	ChordPattern("110110110001", "M7(b9,#9,#11)", L"∆(b9,#9,#11)", Major),
+	ChordPattern("110110110101", "M7(b9,#9,#11,13)", L"∆(b9,#9,#11,13)", Major),
+	ChordPattern("110110111001", "M7(b9,#9,#11,b13)", L"∆alt", Major),
+	ChordPattern("110111010001", "M7(b9,#9,11)", L"∆(b9,#9,11)", Major),
+	ChordPattern("110111010101", "M7(b9,#9,11,13)", L"∆(b9,#9,11,13)", Major),
+	ChordPattern("110111011001", "M7(b9,#9,11,b13)", L"∆(b9,#9,11,b13)", Major),
+	ChordPattern("110011010001", "M7(b9,11)", L"∆(b9,11)", Major),
+	ChordPattern("110010010101", "M7(b9,13)", L"∆(b9,13)", Major),
+	ChordPattern("110010011001", "M7(b9,b13)", L"∆(b9,b13)", Major),
+	ChordPattern("101010010001", "M9", L"∆9", Major),
+	ChordPattern("101010110001", "M9(#11)", L"∆9(#11)", Major),
+	ChordPattern("101010111001", "M9(#11,b13)", L"∆9(#11,b13)", Major),
+	ChordPattern("101010010101", "M9(13)", L"∆9(13)", Major),
+	ChordPattern("101010111101", "M9(6,#11,b13)", L"∆9(6,#11,b13)", Major),
+	ChordPattern("101010011001", "M9(b13)", L"∆9(b13)", Major),
+	ChordPattern("101010100001", "M9(b5)", L"∆9(b5)", Major),
+	ChordPattern("101010100101", "M9(b5,13)", L"∆9(b5,13)", Major),
+	//minor
+	ChordPattern("100100010000", "m", L"-", Minor),
+	ChordPattern("100100110100", "m(#11,13)", L"-(#11,13)", Minor),
+	ChordPattern("100100111000", "m(#11,b13)", L"-(#11,b13)", Minor),
+	ChordPattern("100100001000", "m(#5)", L"-(#5)", Minor),
+	ChordPattern("100101001000", "m(#5,11)", L"-(#5,11)", Minor),
+	ChordPattern("100101001100", "m(#5,11,13)", L"-(#5,11,13)", Minor),
+	ChordPattern("100100001100", "m(#5,13)", L"-(#5,13)", Minor),
+	ChordPattern("101100001000", "m(#5,9)", L"-(#5,9)", Minor),
+	ChordPattern("101101001000", "m(#5,9,11)", L"-(#5,9,11)", Minor),
+	ChordPattern("101101001100", "m(#5,9,11,13)", L"-(#5,9,11,13)", Minor),
+	ChordPattern("101100001100", "m(#5,9,13)", L"-(#5,9,13)", Minor),
+	ChordPattern("110100001000", "m(#5,b9)", L"-(#5,b9)", Minor),
+	ChordPattern("110101001000", "m(#5,b9,11)", L"-(#5,b9,11)", Minor),
+	ChordPattern("110101001100", "m(#5,b9,11,13)", L"-(#5,b9,11,13)", Minor),
+	ChordPattern("100101010100", "m(11,13)", L"-(11,13)", Minor),
+	ChordPattern("100101011000", "m(11,b13)", L"-(11,b13)", Minor),
+	ChordPattern("101100110000", "m(9,#11)", L"-(9,#11)", Minor),
+	ChordPattern("101100110100", "m(9,#11,13)", L"-(9,#11,13)", Minor),
+	ChordPattern("101100111000", "m(9,#11,b13)", L"-(9,#11,b13)", Minor),
+	ChordPattern("101101010000", "m(9,11)", L"-(9,11)", Minor),
+	ChordPattern("101101010100", "m(9,11,13)", L"-(9,11,13)", Minor),
+	ChordPattern("101101011000", "m(9,11,b13)", L"-(9,11,b13)", Minor),
+	ChordPattern("101100010100", "m(9,13)", L"-(9,13)", Minor),
+	ChordPattern("101100011000", "m(9,b13)", L"-(9,b13)", Minor),
+	ChordPattern("100100110000", "m(add#11)", L"-(add#11)", Minor),
+	ChordPattern("100101010000", "m(add11)", L"-(add11)", Minor),
+	ChordPattern("101100010000", "m(add9)", L"-(add9)", Minor),
+	ChordPattern("100100011000", "m(addb13)", L"-(addb13)", Minor),
+	ChordPattern("110100010000", "m(addb9)", L"-(addb9)", Minor),
+	ChordPattern("110100110000", "m(b9,#11)", L"-(b9,#11)", Minor),
+	ChordPattern("110100110100", "m(b9,#11,13)", L"-(b9,#11,13)", Minor),
+	ChordPattern("110100111000", "m(b9,#11,b13)", L"-(b9,#11,b13)", Minor),
+	ChordPattern("110101010000", "m(b9,11)", L"-(b9,11)", Minor),
+	ChordPattern("110101010100", "m(b9,11,13)", L"-(b9,11,13)", Minor),
+	ChordPattern("110101011000", "m(b9,11,b13)", L"-(b9,11,b13)", Minor),
+	ChordPattern("110100010100", "m(b9,13)", L"-(b9,13)", Minor),
+	ChordPattern("110100011000", "m(b9,b13)", L"-(b9,b13)", Minor),
+	ChordPattern("101101010001", "m(M11)", L"-∆11", Minor),
+	ChordPattern("101101001001", "m(M11)(#5)", L"-∆11(#5)", Minor),
+	ChordPattern("110101001001", "m(M11)(#5,b9)", L"-∆11(#5,b9)", Minor),
+	ChordPattern("101101011101", "m(M11)(6,b13)", L"-∆11(6,b13)", Minor),
+	ChordPattern("110101011101", "m(M11)(6,b9,b13)", L"-∆11(6,b9,b13)", Minor),
+	ChordPattern("101101011001", "m(M11)(b13)", L"-∆11(b13)", Minor),
+	ChordPattern("110101011001", "m(M11)(b9,b13)", L"-∆11(b9,b13)", Minor),
+	ChordPattern("101101010101", "m(M13)", L"-∆13", Minor),
+	ChordPattern("101100110101", "m(M13)(#11)", L"-∆13(#11)", Minor),
+	ChordPattern("101101001101", "m(M13)(#5)", L"-∆13(#5)", Minor),
+	ChordPattern("110101001101", "m(M13)(#5,b9)", L"-∆13(#5,b9)", Minor),
+	ChordPattern("110101010101", "m(M13)(b9)", L"-∆13(b9)", Minor),
+	ChordPattern("110100110101", "m(M13)(b9,#11)", L"-∆13(b9,#11)", Minor),
+	ChordPattern("100100010001", "m(M7)", L"-∆", Minor),
+	ChordPattern("100100110001", "m(M7)(#11)", L"-∆(#11)", Minor),
+	ChordPattern("100100110101", "m(M7)(#11,13)", L"-∆(#11,13)", Minor),
+	ChordPattern("100100111001", "m(M7)(#11,b13)", L"-∆(#11,b13)", Minor),
+	ChordPattern("100100001001", "m(M7)(#5)", L"-∆(#5)", Minor),
+	ChordPattern("100101001001", "m(M7)(#5,11)", L"-∆(#5,11)", Minor),
+	ChordPattern("100101001101", "m(M7)(#5,11,13)", L"-∆(#5,11,13)", Minor),
+	ChordPattern("100100001101", "m(M7)(#5,13)", L"-∆(#5,13)", Minor),
+	ChordPattern("110100001001", "m(M7)(#5,b9)", L"-∆(#5,b9)", Minor),
+	ChordPattern("110100001101", "m(M7)(#5,b9,13)", L"-∆(#5,b9,13)", Minor),
+	ChordPattern("100101010001", "m(M7)(11)", L"-∆(11)", Minor),
+	ChordPattern("100101010101", "m(M7)(11,13)", L"-∆(11,13)", Minor),
+	ChordPattern("100101011001", "m(M7)(11,b13)", L"-∆(11,b13)", Minor),
+	ChordPattern("100100010101", "m(M7)(13)", L"-∆(13)", Minor),
+	ChordPattern("100100111101", "m(M7)(6,#11,b13)", L"-∆(6,#11,b13)", Minor),
+	ChordPattern("100101011101", "m(M7)(6,11,b13)", L"-∆(6,11,b13)", Minor),
+	ChordPattern("100100011101", "m(M7)(6,b13)", L"-∆(6,b13)", Minor),
+	ChordPattern("110100111101", "m(M7)(6,b9,#11,b13)", L"-∆(6,b9,#11,b13)", Minor),
+	ChordPattern("110100011101", "m(M7)(6,b9,b13)", L"-∆(6,b9,b13)", Minor),
+	ChordPattern("100100011001", "m(M7)(b13)", L"-∆(b13)", Minor),
+	ChordPattern("110100010001", "m(M7)(b9)", L"-∆(b9)", Minor),
+	ChordPattern("110100110001", "m(M7)(b9,#11)", L"-∆(b9,#11)", Minor),
+	ChordPattern("110100111001", "m(M7)(b9,#11,b13)", L"-∆(b9,#11,b13)", Minor),
+	ChordPattern("110101010001", "m(M7)(b9,11)", L"-∆(b9,11)", Minor),
+	ChordPattern("110100010101", "m(M7)(b9,13)", L"-∆(b9,13)", Minor),
+	ChordPattern("110100011001", "m(M7)(b9,b13)", L"-∆(b9,b13)", Minor),
+	ChordPattern("101100010001", "m(M9)", L"-∆9", Minor),
+	ChordPattern("101100110001", "m(M9)(#11)", L"-∆9(#11)", Minor),
+	ChordPattern("101100111001", "m(M9)(#11,b13)", L"-∆9(#11,b13)", Minor),
+	ChordPattern("101100001001", "m(M9)(#5)", L"-∆9(#5)", Minor),
+	ChordPattern("101100001101", "m(M9)(#5,13)", L"-∆9(#5,13)", Minor),
+	ChordPattern("101100010101", "m(M9)(13)", L"-∆9(13)", Minor),
+	ChordPattern("101100111101", "m(M9)(6,#11,b13)", L"-∆9(6,#11,b13)", Minor),
+	ChordPattern("101100011101", "m(M9)(6,b13)", L"-∆9(6,b13)", Minor),
+	ChordPattern("101100011001", "m(M9)(b13)", L"-∆9(b13)", Minor),
+	ChordPattern("101101010010", "m11", L"-11", Minor),
+	ChordPattern("101101001010", "m11(#5)", L"-11(#5)", Minor),
+	ChordPattern("110101001010", "m11(#5,b9)", L"-11(#5,b9)", Minor),
+	ChordPattern("101101011110", "m11(6,b13)", L"-11(6,b13)", Minor),
+	ChordPattern("101101011010", "m11(b13)", L"-11(b13)", Minor),
+	ChordPattern("110101011010", "m11(b9,b13)", L"-11(b9,b13)", Minor),
+	ChordPattern("101101010110", "m13", L"-13", Minor),
+	ChordPattern("101100110110", "m13(#11)", L"-13(#11)", Minor),
+	ChordPattern("101101001110", "m13(#5)", L"-13(#5)", Minor),
+	ChordPattern("101100101110", "m13(#5,#11)", L"-13(#5,#11)", Minor),
+	ChordPattern("110101001110", "m13(#5,b9)", L"-13(#5,b9)", Minor),
+	ChordPattern("110100101110", "m13(#5,b9,#11)", L"-13(#5,b9,#11)", Minor),
+	ChordPattern("110101010110", "m13(b9)", L"-13(b9)", Minor),
+	ChordPattern("110100110110", "m13(b9,#11)", L"-13(b9,#11)", Minor),
+	ChordPattern("100100010100", "m6", L"-6", Minor),
+	ChordPattern("100100111100", "m6(#11,b13)", L"-6(#11,b13)", Minor),
+	ChordPattern("110100001100", "m6(#5,b9)", L"-6(#5,b9)", Minor),
+	ChordPattern("101101011100", "m6(9,11,b13)", L"-6(9,11,b13)", Minor),
+	ChordPattern("101100011100", "m6(9,b13)", L"-6(9,b13)", Minor),
+	ChordPattern("100100011100", "m6(b13)", L"-6(b13)", Minor),
+	ChordPattern("110101011100", "m6(b9,11,b13)", L"-6(b9,11,b13)", Minor),
+	ChordPattern("110100011100", "m6(b9,b13)", L"-6(b9,b13)", Minor),
+	ChordPattern("100100010010", "m7", L"-7", Minor),
+	ChordPattern("100100110010", "m7(#11)", L"-7(#11)", Minor),
+	ChordPattern("100100110110", "m7(#11,13)", L"-7(#11,13)", Minor),
+	ChordPattern("100100111010", "m7(#11,b13)", L"-7(#11,b13)", Minor),
+	ChordPattern("100100001010", "m7(#5)", L"-7(#5)", Minor),
+	ChordPattern("100100101110", "m7(#5,#11,13)", L"-7(#5,#11,13)", Minor),
+	ChordPattern("100101001010", "m7(#5,11)", L"-7(#5,11)", Minor),
+	ChordPattern("100101001110", "m7(#5,11,13)", L"-7(#5,11,13)", Minor),
+	ChordPattern("100100001110", "m7(#5,13)", L"-7(#5,13)", Minor),
+	ChordPattern("110100001010", "m7(#5,b9)", L"-7(#5,b9)", Minor),
+	ChordPattern("110100001110", "m7(#5,b9,13)", L"-7(#5,b9,13)", Minor),
+	ChordPattern("100101010010", "m7(11)", L"-7(11)", Minor),
+	ChordPattern("100101010110", "m7(11,13)", L"-7(11,13)", Minor),
+	ChordPattern("100101011010", "m7(11,b13)", L"-7(11,b13)", Minor),
+	ChordPattern("100100010110", "m7(13)", L"-7(13)", Minor),
+	ChordPattern("100100111110", "m7(6,#11,b13)", L"-7(6,#11,b13)", Minor),
+	ChordPattern("100101011110", "m7(6,11,b13)", L"-7(6,11,b13)", Minor),
+	ChordPattern("100100011110", "m7(6,b13)", L"-7(6,b13)", Minor),
+	ChordPattern("110100111110", "m7(6,b9,#11,b13)", L"-7(6,b9,#11,b13)", Minor),
+	ChordPattern("100100011010", "m7(b13)", L"-7(b13)", Minor),
+	ChordPattern("110100010010", "m7(b9)", L"-7(b9)", Minor),
+	ChordPattern("110100110010", "m7(b9,#11)", L"-7(b9,#11)", Minor),
+	ChordPattern("110100111010", "m7(b9,#11,b13)", L"-7(b9,#11,b13)", Minor),
+	ChordPattern("110101010010", "m7(b9,11)", L"-7(b9,11)", Minor),
+	ChordPattern("110100010110", "m7(b9,13)", L"-7(b9,13)", Minor),
+	ChordPattern("110100011010", "m7(b9,b13)", L"-7(b9,b13)", Minor),
+	ChordPattern("101100010010", "m9", L"-9", Minor),
+	ChordPattern("101100110010", "m9(#11)", L"-9(#11)", Minor),
+	ChordPattern("101100111010", "m9(#11,b13)", L"-9(#11,b13)", Minor),
+	ChordPattern("101100001010", "m9(#5)", L"-9(#5)", Minor),
+	ChordPattern("101100001110", "m9(#5,13)", L"-9(#5,13)", Minor),
+	ChordPattern("101100010110", "m9(13)", L"-9(13)", Minor),
+	ChordPattern("101100111100", "m9(6,#11,b13)", L"-9(6,#11,b13)", Minor),
+	ChordPattern("101100011110", "m9(6,b13)", L"-9(6,b13)", Minor),
+	ChordPattern("101100011010", "m9(b13)", L"-9(b13)", Minor),
+	//augmented
+	ChordPattern("100010001000", "aug", L"+", Aug),
+	ChordPattern("100010101100", "aug(#11,13)", L"+(#11,13)", Aug),
+	ChordPattern("100110101000", "aug(#9,#11)", L"+(#9,#11)", Aug),
+	ChordPattern("100110101100", "aug(#9,#11,13)", L"+(#9,#11,13)", Aug),
+	ChordPattern("100111001000", "aug(#9,11)", L"+(#9,11)", Aug),
+	ChordPattern("100111001100", "aug(#9,11,13)", L"+(#9,11,13)", Aug),
+	ChordPattern("100110001100", "aug(#9,13)", L"+(#9,13)", Aug),
+	ChordPattern("100011001100", "aug(11,13)", L"+(11,13)", Aug),
+	ChordPattern("101010101000", "aug(9,#11)", L"+(9,#11)", Aug),
+	ChordPattern("101010101100", "aug(9,#11,13)", L"+(9,#11,13)", Aug),
+	ChordPattern("101011001000", "aug(9,11)", L"+(9,11)", Aug),
+	ChordPattern("101011001100", "aug(9,11,13)", L"+(9,11,13)", Aug),
+	ChordPattern("101010001100", "aug(9,13)", L"+(9,13)", Aug),
+	ChordPattern("100010101000", "aug(add#11)", L"+(add#11)", Aug),
+	ChordPattern("100110001000", "aug(add#9)", L"+(add#9)", Aug),
+	ChordPattern("100011001000", "aug(add11)", L"+(add11)", Aug),
+	ChordPattern("101010001000", "aug(add9)", L"+(add9)", Aug),
+	ChordPattern("110010001000", "aug(addb9)", L"+(addb9)", Aug),
+	ChordPattern("110010101000", "aug(b9,#11)", L"+(b9,#11)", Aug),
+	ChordPattern("110010101100", "aug(b9,#11,13)", L"+(b9,#11,13)", Aug),
+	ChordPattern("110110001000", "aug(b9,#9)", L"+(b9,#9)", Aug),
+	ChordPattern("110110101000", "aug(b9,#9,#11)", L"+(b9,#9,#11)", Aug),
+	ChordPattern("110110101010", "aug(b9,#9,#11,13)", L"+(b9,#9,#11,13)", Aug),
+	ChordPattern("110110101100", "aug(b9,#9,#11,b13)", L"+alt", Aug),
+	ChordPattern("110111001000", "aug(b9,#9,11)", L"+(b9,#9,11)", Aug),
+	ChordPattern("110111001010", "aug(b9,#9,11,13)", L"+(b9,#9,11,13)", Aug),
+	ChordPattern("110111001100", "aug(b9,#9,11,b13)", L"+(b9,#9,11,b13)", Aug),
+	ChordPattern("110011001000", "aug(b9,11)", L"+(b9,11)", Aug),
+	ChordPattern("110011001100", "aug(b9,11,13)", L"+(b9,11,13)", Aug),
+	ChordPattern("110010001100", "aug(b9,13)", L"+(b9,13)", Aug),
+	ChordPattern("101011001001", "aug(M11)", L"+∆11", Aug),
+	ChordPattern("100111001001", "aug(M11)(#9)", L"+∆11(#9)", Aug),
+	ChordPattern("110011001001", "aug(M11)(b9)", L"+∆11(b9)", Aug),
+	ChordPattern("101011001101", "aug(M13)", L"+∆13", Aug),
+	ChordPattern("101010101101", "aug(M13)(#11)", L"+∆13(#11)", Aug),
+	ChordPattern("100111001101", "aug(M13)(#9)", L"+∆13(#9)", Aug),
+	ChordPattern("100110101101", "aug(M13)(#9,#11)", L"+∆13(#9,#11)", Aug),
+	ChordPattern("110011001101", "aug(M13)(b9)", L"+∆13(b9)", Aug),
+	ChordPattern("110010101101", "aug(M13)(b9,#11)", L"+∆13(b9,#11)", Aug),
+	ChordPattern("100010001001", "aug(M7)", L"+∆", Aug),
+	ChordPattern("100010101001", "aug(M7)(#11)", L"+∆(#11)", Aug),
+	ChordPattern("100010101101", "aug(M7)(#11,13)", L"+∆(#11,13)", Aug),
+	ChordPattern("100110001001", "aug(M7)(#9)", L"+∆(#9)", Aug),
+	ChordPattern("100110101001", "aug(M7)(#9,#11)", L"+∆(#9,#11)", Aug),
+	ChordPattern("100110001101", "aug(M7)(#9,13)", L"+∆(#9,13)", Aug),
+	ChordPattern("100011001001", "aug(M7)(11)", L"+∆(11)", Aug),
+	ChordPattern("100011001101", "aug(M7)(11,13)", L"+∆(11,13)", Aug),
+	ChordPattern("100010001101", "aug(M7)(13)", L"+∆(13)", Aug),
+	ChordPattern("110010001001", "aug(M7)(b9)", L"+∆(b9)", Aug),
+	ChordPattern("110010101001", "aug(M7)(b9,#11)", L"+∆(b9,#11)", Aug),
+	ChordPattern("110110001001", "aug(M7)(b9,#9)", L"+∆(b9,#9)", Aug),
+	ChordPattern("110110101001", "aug(M7)(b9,#9,#11)", L"+∆(b9,#9,#11)", Aug),
+	ChordPattern("110110101101", "aug(M7)(b9,#9,#11,13)", L"+∆(b9,#9,#11,13)", Aug),
+	ChordPattern("110111001001", "aug(M7)(b9,#9,11)", L"+∆(b9,#9,11)", Aug),
+	ChordPattern("110111001101", "aug(M7)(b9,#9,11,13)", L"+∆(b9,#9,11,13)", Aug),
+	ChordPattern("110010001101", "aug(M7)(b9,13)", L"+∆(b9,13)", Aug),
+	ChordPattern("101010001001", "aug(M9)", L"+∆9", Aug),
+	ChordPattern("101010101001", "aug(M9)(#11)", L"+∆9(#11)", Aug),
+	ChordPattern("101010001101", "aug(M9)(13)", L"+∆9(13)", Aug),
+	ChordPattern("101011001010", "aug11", L"+11", Aug),
+	ChordPattern("100111001010", "aug11(#9)", L"+11(#9)", Aug),
+	ChordPattern("110011001010", "aug11(b9)", L"+11(b9)", Aug),
+	ChordPattern("101011001110", "aug13", L"+13", Aug),
+	ChordPattern("101010101110", "aug13(#11)", L"+13(#11)", Aug),
+	ChordPattern("100111001110", "aug13(#9)", L"+13(#9)", Aug),
+	ChordPattern("100110101110", "aug13(#9,#11)", L"+13(#9,#11)", Aug),
+	ChordPattern("110011001110", "aug13(b9)", L"+13(b9)", Aug),
+	ChordPattern("110010101110", "aug13(b9,#11)", L"+13(b9,#11)", Aug),
+	ChordPattern("100010001100", "aug6", L"+6", Aug),
+	ChordPattern("100010001010", "aug7", L"+7", Aug),
+	ChordPattern("100010101010", "aug7(#11)", L"+7(#11)", Aug),
+	ChordPattern("100010101110", "aug7(#11,13)", L"+7(#11,13)", Aug),
+	ChordPattern("100110001010", "aug7(#9)", L"+7(#9)", Aug),
+	ChordPattern("100110101010", "aug7(#9,#11)", L"+7(#9,#11)", Aug),
+	ChordPattern("100110001110", "aug7(#9,13)", L"+7(#9,13)", Aug),
+	ChordPattern("100011001010", "aug7(11)", L"+7(11)", Aug),
+	ChordPattern("100011001110", "aug7(11,13)", L"+7(11,13)", Aug),
+	ChordPattern("100010001110", "aug7(13)", L"+7(13)", Aug),
+	ChordPattern("110010001010", "aug7(b9)", L"+7(b9)", Aug),
+	ChordPattern("110010101010", "aug7(b9,#11)", L"+7(b9,#11)", Aug),
+	ChordPattern("110110001010", "aug7(b9,#9)", L"+7(b9,#9)", Aug),
+	ChordPattern("110110101110", "aug7(b9,#9,#11,13)", L"+7(b9,#9,#11,13)", Aug),
+	ChordPattern("110111001110", "aug7(b9,#9,11,13)", L"+7(b9,#9,11,13)", Aug),
+	ChordPattern("110010001110", "aug7(b9,13)", L"+7(b9,13)", Aug),
+	ChordPattern("101010001010", "aug9", L"+9", Aug),
+	ChordPattern("101010101010", "aug9(#11)", L"+9(#11)", Aug),
+	ChordPattern("101010001110", "aug9(13)", L"+9(13)", Aug),
+	//diminished
+	ChordPattern("100100100000", "dim", L"°", Dim),
+	ChordPattern("100101101000", "dim(11,b13)", L"°(11,b13)", Dim),
+	ChordPattern("101101100000", "dim(9,11)", L"°(9,11)", Dim),
+	ChordPattern("101101101000", "dim(9,11,b13)", L"°(9,11,b13)", Dim),
+	ChordPattern("101100101000", "dim(9,b13)", L"°(9,b13)", Dim),
+	ChordPattern("100101100000", "dim(add11)", L"°(add11)", Dim),
+	ChordPattern("101100100000", "dim(add9)", L"°(add9)", Dim),
+	ChordPattern("100100101000", "dim(addb13)", L"°(addb13)", Dim),
+	ChordPattern("110100100000", "dim(addb9)", L"°(addb9)", Dim),
+	ChordPattern("110101100000", "dim(b9,11)", L"°(b9,11)", Dim),
+	ChordPattern("110101101000", "dim(b9,11,b13)", L"°(b9,11,b13)", Dim),
+	ChordPattern("110100101000", "dim(b9,b13)", L"°(b9,b13)", Dim),
+	ChordPattern("101101100001", "dim(M11)", L"°∆11", Dim),
+	ChordPattern("101101101101", "dim(M11)(6,b13)", L"°∆11(6,b13)", Dim),
+	ChordPattern("101101101001", "dim(M11)(b13)", L"°∆11(b13)", Dim),
+	ChordPattern("110101101001", "dim(M11)(b9,b13)", L"°∆11(b9,b13)", Dim),
+	ChordPattern("101101100101", "dim(M13)", L"°∆13", Dim),
+	ChordPattern("110101100101", "dim(M13)(b9)", L"°∆13(b9)", Dim),
+	ChordPattern("100100100001", "dim(M7)", L"°∆", Dim),
+	ChordPattern("100101100001", "dim(M7)(11)", L"°∆(11)", Dim),
+	ChordPattern("100101100101", "dim(M7)(11,13)", L"°∆(11,13)", Dim),
+	ChordPattern("100101101001", "dim(M7)(11,b13)", L"°∆(11,b13)", Dim),
+	ChordPattern("100100100101", "dim(M7)(13)", L"°∆(13)", Dim),
+	ChordPattern("100101101101", "dim(M7)(6,11,b13)", L"°∆(6,11,b13)", Dim),
+	ChordPattern("100100101101", "dim(M7)(6,b13)", L"°∆(6,b13)", Dim),
+	ChordPattern("110100101101", "dim(M7)(6,b9,b13)", L"°∆(6,b9,b13)", Dim),
+	ChordPattern("100100101001", "dim(M7)(b13)", L"°∆(b13)", Dim),
+	ChordPattern("110100100001", "dim(M7)(b9)", L"°∆(b9)", Dim),
+	ChordPattern("110101100001", "dim(M7)(b9,11)", L"°∆(b9,11)", Dim),
+	ChordPattern("110100100101", "dim(M7)(b9,13)", L"°∆(b9,13)", Dim),
+	ChordPattern("110100101001", "dim(M7)(b9,b13)", L"°∆(b9,b13)", Dim),
+	ChordPattern("101100100001", "dim(M9)", L"°∆9", Dim),
+	ChordPattern("101100100101", "dim(M9)(13)", L"°∆9(13)", Dim),
+	ChordPattern("101100101101", "dim(M9)(6,b13)", L"°∆9(6,b13)", Dim),
+	ChordPattern("101100101001", "dim(M9)(b13)", L"°∆9(b13)", Dim),
+	ChordPattern("101101100100", "dim11", L"°11", Dim),
+	ChordPattern("101101101100", "dim11(b13)", L"°11(b13)", Dim),
+	ChordPattern("110101101100", "dim11(b9,b13)", L"°11(b9,b13)", Dim),
+	ChordPattern("100100100100", "dim7", L"°7", Dim),
+	ChordPattern("100101100100", "dim7(11)", L"°7(11)", Dim),
+	ChordPattern("100101101100", "dim7(11,b13)", L"°7(11,b13)", Dim),
+	ChordPattern("100100101100", "dim7(b13)", L"°7(b13)", Dim),
+	ChordPattern("110100100100", "dim7(b9)", L"°7(b9)", Dim),
+	ChordPattern("110101100100", "dim7(b9,11)", L"°7(b9,11)", Dim),
+	ChordPattern("110100101100", "dim7(b9,b13)", L"°7(b9,b13)", Dim),
+	ChordPattern("101100100100", "dim9", L"°9", Dim),
+	ChordPattern("101100101100", "dim9(b13)", L"°9(b13)", Dim),
+	ChordPattern("101101101110", "m11(b5,6,b13)", L"ø11(6,b13)", Dim),
+	ChordPattern("100100100010", "m7(b5)", L"ø", Dim),
+	ChordPattern("100101100010", "m7(b5,11)", L"ø(11)", Dim),
+	ChordPattern("100101100110", "m7(b5,11,13)", L"ø(11,13)", Dim),
+	ChordPattern("100101101010", "m7(b5,11,b13)", L"ø(11,b13)", Dim),
+	ChordPattern("100100100110", "m7(b5,13)", L"ø(13)", Dim),
+	ChordPattern("100101101110", "m7(b5,6,11,b13)", L"ø(6,11,b13)", Dim),
+	ChordPattern("110101101110", "m7(b5,6,b9,11,b13)", L"ø(6,b9,11,b13)", Dim),
+	ChordPattern("100100101010", "m7(b5,b13)", L"ø(b13)", Dim),
+	ChordPattern("110100100010", "m7(b5,b9)", L"ø(b9)", Dim),
+	ChordPattern("110101100010", "m7(b5,b9,11)", L"ø(b9,11)", Dim),
+	ChordPattern("110101100110", "m7(b5,b9,11,13)", L"ø(b9,11,13)", Dim),
+	ChordPattern("110101101010", "m7(b5,b9,11,b13)", L"ø(b9,11,b13)", Dim),
+	ChordPattern("110100100110", "m7(b5,b9,13)", L"ø(b9,13)", Dim),
+	ChordPattern("110100101010", "m7(b5,b9,b13)", L"ø(b9,b13)", Dim),
+	ChordPattern("101100100010", "m9(b5)", L"ø9", Dim),
+	ChordPattern("101101100010", "m9(b5,11)", L"ø9(11)", Dim),
+	ChordPattern("101101100110", "m9(b5,11,13)", L"ø9(11,13)", Dim),
+	ChordPattern("101101101010", "m9(b5,11,b13)", L"ø9(11,b13)", Dim),
+	ChordPattern("101100100110", "m9(b5,13)", L"ø9(13)", Dim),
+	ChordPattern("101100101010", "m9(b5,b13)", L"ø9(b13)", Dim),
+	//suspended 2nd
+	ChordPattern("101000010000", "sus2", L"sus2", Sus),
+	ChordPattern("101000111100", "6sus2(#11,b13)", L"6sus2(#11,b13)", Sus),
+	ChordPattern("101001011100", "6sus2(11,b13)", L"6sus2(11,b13)", Sus),
+	ChordPattern("101000011100", "6sus2(b13)", L"6sus2(b13)", Sus),
+	ChordPattern("101001101100", "6sus2(b5,11,b13)", L"6sus2(b5,11,b13)", Sus),
+	ChordPattern("101000101100", "6sus2(b5,b13)", L"6sus2(b5,b13)", Sus),
+	ChordPattern("111001101100", "6sus2(b5,b9,11,b13)", L"6sus2(b5,b9,11,b13)", Sus),
+	ChordPattern("111000101100", "6sus2(b5,b9,b13)", L"6sus2(b5,b9,b13)", Sus),
+	ChordPattern("111001011100", "6sus2(b9,11,b13)", L"6sus2(b9,11,b13)", Sus),
+	ChordPattern("111000011100", "6sus2(b9,b13)", L"6sus2(b9,b13)", Sus),
+	ChordPattern("101000010010", "7sus2", L"7sus2", Sus),
+	ChordPattern("101000110010", "7sus2(#11)", L"7sus2(#11)", Sus),
+	ChordPattern("101000110110", "7sus2(#11,13)", L"7sus2(#11,13)", Sus),
+	ChordPattern("101000111010", "7sus2(#11,b13)", L"7sus2(#11,b13)", Sus),
+	ChordPattern("101000010110", "7sus2(13)", L"7sus2(13)", Sus),
+	ChordPattern("101000111110", "7sus2(6,#11,b13)", L"7sus2(6,#11,b13)", Sus),
+	ChordPattern("101100111110", "7sus2(6,#9,#11,b13)", L"7sus2(6,#9,#11,b13)", Sus),
+	ChordPattern("101000011110", "7sus2(6,b13)", L"7sus2(6,b13)", Sus),
+	ChordPattern("111000111110", "7sus2(6,b9,#11,b13)", L"7sus2(6,b9,#11,b13)", Sus),
+	ChordPattern("101000011010", "7sus2(b13)", L"7sus2(b13)", Sus),
+	ChordPattern("101000100010", "7sus2(b5)", L"7sus2(b5)", Sus),
+	ChordPattern("101000100110", "7sus2(b5,13)", L"7sus2(b5,13)", Sus),
+	ChordPattern("101000101110", "7sus2(b5,6,b13)", L"7sus2(b5,6,b13)", Sus),
+	ChordPattern("111000101110", "7sus2(b5,6,b9,b13)", L"7sus2(b5,6,b9,b13)", Sus),
+	ChordPattern("101000101010", "7sus2(b5,b13)", L"7sus2(b5,b13)", Sus),
+	ChordPattern("111000100010", "7sus2(b5,b9)", L"7sus2(b5,b9)", Sus),
+	ChordPattern("111001101010", "7sus2(b5,b9,11,b13)", L"7sus2(b5,b9,11,b13)", Sus),
+	ChordPattern("111000100110", "7sus2(b5,b9,13)", L"7sus2(b5,b9,13)", Sus),
+	ChordPattern("111000101010", "7sus2(b5,b9,b13)", L"7sus2(b5,b9,b13)", Sus),
+	ChordPattern("111000010010", "7sus2(b9)", L"7sus2(b9)", Sus),
+	ChordPattern("111000110010", "7sus2(b9,#11)", L"7sus2(b9,#11)", Sus),
+	ChordPattern("111000111010", "7sus2(b9,#11,b13)", L"7sus2(b9,#11,b13)", Sus),
+	ChordPattern("111100010010", "7sus2(b9,#9)", L"7sus2(b9,#9)", Sus),
+	ChordPattern("111100110010", "7sus2(b9,#9,#11)", L"7sus2(b9,#9,#11)", Sus),
+	ChordPattern("111100110110", "7sus2(b9,#9,#11,13)", L"7sus2(b9,#9,#11,13)", Sus),
+	ChordPattern("111100111010", "7sus2(b9,#9,#11,b13)", L"7sus2alt", Sus),
+	ChordPattern("111101010010", "7sus2(b9,#9,11)", L"7sus2(b9,#9,11)", Sus),
+	ChordPattern("111101010110", "7sus2(b9,#9,11,13)", L"7sus2(b9,#9,11,13)", Sus),
+	ChordPattern("111101011010", "7sus2(b9,#9,11,b13)", L"7sus2(b9,#9,11,b13)", Sus),
+	ChordPattern("111001010010", "7sus2(b9,11)", L"7sus2(b9,11)", Sus),
+	ChordPattern("111001011010", "7sus2(b9,11,b13)", L"7sus2(b9,11,b13)", Sus),
+	ChordPattern("111000010110", "7sus2(b9,13)", L"7sus2(b9,13)", Sus),
+	ChordPattern("111000011010", "7sus2(b9,b13)", L"7sus2(b9,b13)", Sus),
+	ChordPattern("111001011001", "M11sus2(b9,b13)", L"∆11sus2(b9,b13)", Sus),
+	ChordPattern("111001010101", "M13sus2(b9)", L"∆13sus2(b9)", Sus),
+	ChordPattern("101000010001", "M7sus2", L"∆sus2", Sus),
+	ChordPattern("101000110001", "M7sus2(#11)", L"∆sus2(#11)", Sus),
+	ChordPattern("101000110101", "M7sus2(#11,13)", L"∆sus2(#11,13)", Sus),
+	ChordPattern("101000111001", "M7sus2(#11,b13)", L"∆sus2(#11,b13)", Sus),
+	ChordPattern("101001010001", "M7sus2(11)", L"∆sus2(11)", Sus),
+	ChordPattern("101001010101", "M7sus2(11,13)", L"∆sus2(11,13)", Sus),
+	ChordPattern("101001011001", "M7sus2(11,b13)", L"∆sus2(11,b13)", Sus),
+	ChordPattern("101000010101", "M7sus2(13)", L"∆sus2(13)", Sus),
+	ChordPattern("101000111101", "M7sus2(6,#11,b13)", L"∆sus2(6,#11,b13)", Sus),
+	ChordPattern("101001011101", "M7sus2(6,11,b13)", L"∆sus2(6,11,b13)", Sus),
+	ChordPattern("101000011101", "M7sus2(6,b13)", L"∆sus2(6,b13)", Sus),
+	ChordPattern("111000111101", "M7sus2(6,b9,#11,b13)", L"∆sus2(6,b9,#11,b13)", Sus),
+	ChordPattern("111000011101", "M7sus2(6,b9,b13)", L"∆sus2(6,b9,b13)", Sus),
+	ChordPattern("101000011001", "M7sus2(b13)", L"∆sus2(b13)", Sus),
+	ChordPattern("101000100001", "M7sus2(b5)", L"∆sus2(b5)", Sus),
+	ChordPattern("101000100101", "M7sus2(b5,13)", L"∆sus2(b5,13)", Sus),
+	ChordPattern("101000101101", "M7sus2(b5,6,b13)", L"∆sus2(b5,6,b13)", Sus),
+	ChordPattern("111000101101", "M7sus2(b5,6,b9,b13)", L"∆sus2(b5,6,b9,b13)", Sus),
+	ChordPattern("101000101001", "M7sus2(b5,b13)", L"∆sus2(b5,b13)", Sus),
+	ChordPattern("111000100001", "M7sus2(b5,b9)", L"∆sus2(b5,b9)", Sus),
+	ChordPattern("111000100101", "M7sus2(b5,b9,13)", L"∆sus2(b5,b9,13)", Sus),
+	ChordPattern("111000101001", "M7sus2(b5,b9,b13)", L"∆sus2(b5,b9,b13)", Sus),
+	ChordPattern("111000010001", "M7sus2(b9)", L"∆sus2(b9)", Sus),
+	ChordPattern("111000110001", "M7sus2(b9,#11)", L"∆sus2(b9,#11)", Sus),
+	ChordPattern("111000111001", "M7sus2(b9,#11,b13)", L"∆sus2(b9,#11,b13)", Sus),
+	ChordPattern("111100010001", "M7sus2(b9,#9)", L"∆sus2(b9,#9)", Sus),
+	ChordPattern("111100110001", "M7sus2(b9,#9,#11)", L"∆sus2(b9,#9,#11)", Sus),
+	ChordPattern("111100110101", "M7sus2(b9,#9,#11,13)", L"∆sus2(b9,#9,#11,13)", Sus),
+	ChordPattern("111100111001", "M7sus2(b9,#9,#11,b13)", L"∆sus2alt", Sus),
+	ChordPattern("111101010001", "M7sus2(b9,#9,11)", L"∆sus2(b9,#9,11)", Sus),
+	ChordPattern("111101010101", "M7sus2(b9,#9,11,13)", L"∆sus2(b9,#9,11,13)", Sus),
+	ChordPattern("111101011001", "M7sus2(b9,#9,11,b13)", L"∆sus2(b9,#9,11,b13)", Sus),
+	ChordPattern("111001010001", "M7sus2(b9,11)", L"∆sus2(b9,11)", Sus),
+	ChordPattern("111000010101", "M7sus2(b9,13)", L"∆sus2(b9,13)", Sus),
+	ChordPattern("111000011001", "M7sus2(b9,b13)", L"∆sus2(b9,b13)", Sus),
+	ChordPattern("101000110000", "sus2(#11)", L"sus2(#11)", Sus),
+	ChordPattern("101000110100", "sus2(#11,13)", L"sus2(#11,13)", Sus),
+	ChordPattern("101000111000", "sus2(#11,b13)", L"sus2(#11,b13)", Sus),
+	ChordPattern("101000010100", "sus2(13)", L"sus2(13)", Sus),
+	ChordPattern("101000011000", "sus2(b13)", L"sus2(b13)", Sus),
+	ChordPattern("101000100000", "sus2(b5)", L"sus2(b5)", Sus),
+	ChordPattern("101000100100", "sus2(b5,13)", L"sus2(b5,13)", Sus),
+	ChordPattern("101000101000", "sus2(b5,b13)", L"sus2(b5,b13)", Sus),
+	ChordPattern("111000100000", "sus2(b5,b9)", L"sus2(b5,b9)", Sus),
+	ChordPattern("111000100100", "sus2(b5,b9,13)", L"sus2(b5,b9,13)", Sus),
+	ChordPattern("111000101000", "sus2(b5,b9,b13)", L"sus2(b5,b9,b13)", Sus),
+	ChordPattern("111000010000", "sus2(b9)", L"sus2(b9)", Sus),
+	ChordPattern("111000110000", "sus2(b9,#11)", L"sus2(b9,#11)", Sus),
+	ChordPattern("111000110100", "sus2(b9,#11,13)", L"sus2(b9,#11,13)", Sus),
+	ChordPattern("111000111000", "sus2(b9,#11,b13)", L"sus2(b9,#11,b13)", Sus),
+	ChordPattern("111100010000", "sus2(b9,#9)", L"sus2(b9,#9)", Sus),
+	ChordPattern("111100110000", "sus2(b9,#9,#11)", L"sus2(b9,#9,#11)", Sus),
+	ChordPattern("111100110100", "sus2(b9,#9,#11,13)", L"sus2(b9,#9,#11,13)", Sus),
+	ChordPattern("111100111000", "sus2(b9,#9,#11,b13)", L"sus2alt", Sus),
+	ChordPattern("111101010000", "sus2(b9,#9,11)", L"sus2(b9,#9,11)", Sus),
+	ChordPattern("111101010100", "sus2(b9,#9,11,13)", L"sus2(b9,#9,11,13)", Sus),
+	ChordPattern("111101011000", "sus2(b9,#9,11,b13)", L"sus2(b9,#9,11,b13)", Sus),
+	ChordPattern("111001010000", "sus2(b9,11)", L"sus2(b9,11)", Sus),
+	ChordPattern("111001010100", "sus2(b9,11,13)", L"sus2(b9,11,13)", Sus),
+	ChordPattern("111001011000", "sus2(b9,11,b13)", L"sus2(b9,11,b13)", Sus),
+	ChordPattern("111000010100", "sus2(b9,13)", L"sus2(b9,13)", Sus),
+	ChordPattern("111000011000", "sus2(b9,b13)", L"sus2(b9,b13)", Sus),
+	//suspended 4th
+	ChordPattern("100001010000", "sus4", L"sus4", Sus),
+	ChordPattern("100001011100", "6sus4(b13)", L"6sus4(b13)", Sus),
+	ChordPattern("110001011100", "6sus4(b9,b13)", L"6sus4(b9,b13)", Sus),
+	ChordPattern("100001010010", "7sus4", L"7sus4", Sus),
+	ChordPattern("100001110010", "7sus4(#11)", L"7sus4(#11)", Sus),
+	ChordPattern("100001110110", "7sus4(#11,13)", L"7sus4(#11,13)", Sus),
+	ChordPattern("100001111010", "7sus4(#11,b13)", L"7sus4(#11,b13)", Sus),
+	ChordPattern("100101110010", "7sus4(#9,#11)", L"7sus4(#9,#11)", Sus),
+	ChordPattern("100101111010", "7sus4(#9,#11,b13)", L"7sus4(#9,#11,b13)", Sus),
+	ChordPattern("100001010110", "7sus4(13)", L"7sus4(13)", Sus),
+	ChordPattern("100001111110", "7sus4(6,#11,b13)", L"7sus4(6,#11,b13)", Sus),
+	ChordPattern("100101111110", "7sus4(6,#9,#11,b13)", L"7sus4(6,#9,#11,b13)", Sus),
+	ChordPattern("101001011110", "7sus4(6,9,b13)", L"7sus4(6,9,b13)", Sus),
+	ChordPattern("100001011110", "7sus4(6,b13)", L"7sus4(6,b13)", Sus),
+	ChordPattern("110001111110", "7sus4(6,b9,#11,b13)", L"7sus4(6,b9,#11,b13)", Sus),
+	ChordPattern("100001011010", "7sus4(b13)", L"7sus4(b13)", Sus),
+	ChordPattern("110001010010", "7sus4(b9)", L"7sus4(b9)", Sus),
+	ChordPattern("110001110010", "7sus4(b9,#11)", L"7sus4(b9,#11)", Sus),
+	ChordPattern("110001111010", "7sus4(b9,#11,b13)", L"7sus4(b9,#11,b13)", Sus),
+	ChordPattern("110101110010", "7sus4(b9,#9,#11)", L"7sus4(b9,#9,#11)", Sus),
+	ChordPattern("110101110110", "7sus4(b9,#9,#11,13)", L"7sus4(b9,#9,#11,13)", Sus),
+	ChordPattern("110101111010", "7sus4(b9,#9,#11,b13)", L"7sus4alt", Sus),
+	ChordPattern("110001010110", "7sus4(b9,13)", L"7sus4(b9,13)", Sus),
+	ChordPattern("110001011010", "7sus4(b9,b13)", L"7sus4(b9,b13)", Sus),
+	ChordPattern("101001010010", "9sus4", L"9sus4", Sus),
+	ChordPattern("101001110010", "9sus4(#11)", L"9sus4(#11)", Sus),
+	ChordPattern("101001111010", "9sus4(#11,b13)", L"9sus4(#11,b13)", Sus),
+	ChordPattern("101001010110", "9sus4(13)", L"9sus4(13)", Sus),
+	ChordPattern("101001111110", "9sus4(6,#11,b13)", L"9sus4(6,#11,b13)", Sus),
+	ChordPattern("101001011010", "9sus4(b13)", L"9sus4(b13)", Sus),
+	ChordPattern("100001010001", "M7sus4", L"∆sus4", Sus),
+	ChordPattern("100001110001", "M7sus4(#11)", L"∆sus4(#11)", Sus),
+	ChordPattern("100001110101", "M7sus4(#11,13)", L"∆sus4(#11,13)", Sus),
+	ChordPattern("100001111001", "M7sus4(#11,b13)", L"∆sus4(#11,b13)", Sus),
+	ChordPattern("100101110001", "M7sus4(#9,#11)", L"∆sus4(#9,#11)", Sus),
+	ChordPattern("100101111001", "M7sus4(#9,#11,b13)", L"∆sus4(#9,#11,b13)", Sus),
+	ChordPattern("100001010101", "M7sus4(13)", L"∆sus4(13)", Sus),
+	ChordPattern("100001111101", "M7sus4(6,#11,b13)", L"∆sus4(6,#11,b13)", Sus),
+	ChordPattern("100101111101", "M7sus4(6,#9,#11,b13)", L"∆sus4(6,#9,#11,b13)", Sus),
+	ChordPattern("100001011101", "M7sus4(6,b13)", L"∆sus4(6,b13)", Sus),
+	ChordPattern("110001111101", "M7sus4(6,b9,#11,b13)", L"∆sus4(6,b9,#11,b13)", Sus),
+	ChordPattern("110001011101", "M7sus4(6,b9,b13)", L"∆sus4(6,b9,b13)", Sus),
+	ChordPattern("100001011001", "M7sus4(b13)", L"∆sus4(b13)", Sus),
+	ChordPattern("110001010001", "M7sus4(b9)", L"∆sus4(b9)", Sus),
+	ChordPattern("110001110001", "M7sus4(b9,#11)", L"∆sus4(b9,#11)", Sus),
+	ChordPattern("110001111001", "M7sus4(b9,#11,b13)", L"∆sus4(b9,#11,b13)", Sus),
+	ChordPattern("110101110001", "M7sus4(b9,#9,#11)", L"∆sus4(b9,#9,#11)", Sus),
+	ChordPattern("110101110101", "M7sus4(b9,#9,#11,13)", L"∆sus4(b9,#9,#11,13)", Sus),
+	ChordPattern("110101111001", "M7sus4(b9,#9,#11,b13)", L"∆sus4alt", Sus),
+	ChordPattern("110001010101", "M7sus4(b9,13)", L"∆sus4(b9,13)", Sus),
+	ChordPattern("110001011001", "M7sus4(b9,b13)", L"∆sus4(b9,b13)", Sus),
+	ChordPattern("101001110001", "M9sus4(#11)", L"∆9sus4(#11)", Sus),
+	ChordPattern("101001111001", "M9sus4(#11,b13)", L"∆9sus4(#11,b13)", Sus),
+	ChordPattern("100001110000", "sus4(#11)", L"sus4(#11)", Sus),
+	ChordPattern("100001110100", "sus4(#11,13)", L"sus4(#11,13)", Sus),
+	ChordPattern("100001111000", "sus4(#11,b13)", L"sus4(#11,b13)", Sus),
+	ChordPattern("100101110000", "sus4(#9,#11)", L"sus4(#9,#11)", Sus),
+	ChordPattern("100101110100", "sus4(#9,#11,13)", L"sus4(#9,#11,13)", Sus),
+	ChordPattern("100101111000", "sus4(#9,#11,b13)", L"sus4(#9,#11,b13)", Sus),
+	ChordPattern("100001010100", "sus4(13)", L"sus4(13)", Sus),
+	ChordPattern("101001010000", "sus4(9)", L"sus4(9)", Sus),
+	ChordPattern("101001110000", "sus4(9,#11)", L"sus4(9,#11)", Sus),
+	ChordPattern("101001110100", "sus4(9,#11,13)", L"sus4(9,#11,13)", Sus),
+	ChordPattern("101001111000", "sus4(9,#11,b13)", L"sus4(9,#11,b13)", Sus),
+	ChordPattern("101001010100", "sus4(9,13)", L"sus4(9,13)", Sus),
+	ChordPattern("101001011000", "sus4(9,b13)", L"sus4(9,b13)", Sus),
+	ChordPattern("100001011000", "sus4(b13)", L"sus4(b13)", Sus),
+	ChordPattern("110001010000", "sus4(b9)", L"sus4(b9)", Sus),
+	ChordPattern("110001110000", "sus4(b9,#11)", L"sus4(b9,#11)", Sus),
+	ChordPattern("110001110100", "sus4(b9,#11,13)", L"sus4(b9,#11,13)", Sus),
+	ChordPattern("110001111000", "sus4(b9,#11,b13)", L"sus4(b9,#11,b13)", Sus),
+	ChordPattern("110101110000", "sus4(b9,#9,#11)", L"sus4(b9,#9,#11)", Sus),
+	ChordPattern("110101110100", "sus4(b9,#9,#11,13)", L"sus4(b9,#9,#11,13)", Sus),
+	ChordPattern("110101111000", "sus4(b9,#9,#11,b13)", L"sus4alt", Sus),
+	ChordPattern("110001010100", "sus4(b9,13)", L"sus4(b9,13)", Sus),
+	ChordPattern("110001011000", "sus4(b9,b13)", L"sus4(b9,b13)", Sus),
+	//suspended 2nd and 4th
+	ChordPattern("101001000000", "sus24", L"sus24", Sus),
+	ChordPattern("101001000100", "6sus24", L"6sus24", Sus),
+	ChordPattern("101001001100", "6sus24(b13)", L"6sus24(b13)", Sus),
+	ChordPattern("111001001100", "6sus24(b9,b13)", L"6sus24(b9,b13)", Sus),
+	ChordPattern("101001000010", "7sus24", L"7sus24", Sus),
+	ChordPattern("101001100010", "7sus24(#11)", L"7sus24(#11)", Sus),
+	ChordPattern("101001100110", "7sus24(#11,13)", L"7sus24(#11,13)", Sus),
+	ChordPattern("101001101010", "7sus24(#11,b13)", L"7sus24(#11,b13)", Sus),
+	ChordPattern("101101000010", "7sus24(#9)", L"7sus24(#9)", Sus),
+	ChordPattern("101101000110", "7sus24(#9,13)", L"7sus24(#9,13)", Sus),
+	ChordPattern("101001000110", "7sus24(13)", L"7sus24(13)", Sus),
+	ChordPattern("101001101110", "7sus24(6,#11,b13)", L"7sus24(6,#11,b13)", Sus),
+	ChordPattern("101001001110", "7sus24(6,b13)", L"7sus24(6,b13)", Sus),
+	ChordPattern("111001101110", "7sus24(6,b9,#11,b13)", L"7sus24(6,b9,#11,b13)", Sus),
+	ChordPattern("101001001010", "7sus24(b13)", L"7sus24(b13)", Sus),
+	ChordPattern("111001000010", "7sus24(b9)", L"7sus24(b9)", Sus),
+	ChordPattern("111001100010", "7sus24(b9,#11)", L"7sus24(b9,#11)", Sus),
+	ChordPattern("111101000010", "7sus24(b9,#9)", L"7sus24(b9,#9)", Sus),
+	ChordPattern("111101100010", "7sus24(b9,#9,#11)", L"7sus24(b9,#9,#11)", Sus),
+	ChordPattern("111101100110", "7sus24(b9,#9,#11,13)", L"7sus24(b9,#9,#11,13)", Sus),
+	ChordPattern("111101101010", "7sus24(b9,#9,#11,b13)", L"7sus24alt", Sus),
+	ChordPattern("111101000110", "7sus24(b9,#9,13)", L"7sus24(b9,#9,13)", Sus),
+	ChordPattern("111101001010", "7sus24(b9,#9,b13)", L"7sus24(b9,#9,b13)", Sus),
+	ChordPattern("111001000110", "7sus24(b9,13)", L"7sus24(b9,13)", Sus),
+	ChordPattern("111001001010", "7sus24(b9,b13)", L"7sus24(b9,b13)", Sus),
+	ChordPattern("101001000001", "M7sus24", L"∆sus24", Sus),
+	ChordPattern("101001100001", "M7sus24(#11)", L"∆sus24(#11)", Sus),
+	ChordPattern("101001100101", "M7sus24(#11,13)", L"∆sus24(#11,13)", Sus),
+	ChordPattern("101001101001", "M7sus24(#11,b13)", L"∆sus24(#11,b13)", Sus),
+	ChordPattern("101101000001", "M7sus24(#9)", L"∆sus24(#9)", Sus),
+	ChordPattern("101101000101", "M7sus24(#9,13)", L"∆sus24(#9,13)", Sus),
+	ChordPattern("101001000101", "M7sus24(13)", L"∆sus24(13)", Sus),
+	ChordPattern("101001101101", "M7sus24(6,#11,b13)", L"∆sus24(6,#11,b13)", Sus),
+	ChordPattern("101001001101", "M7sus24(6,b13)", L"∆sus24(6,b13)", Sus),
+	ChordPattern("111001101101", "M7sus24(6,b9,#11,b13)", L"∆sus24(6,b9,#11,b13)", Sus),
+	ChordPattern("111001001101", "M7sus24(6,b9,b13)", L"∆sus24(6,b9,b13)", Sus),
+	ChordPattern("101001001001", "M7sus24(b13)", L"∆sus24(b13)", Sus),
+	ChordPattern("111001000001", "M7sus24(b9)", L"∆sus24(b9)", Sus),
+	ChordPattern("111001100001", "M7sus24(b9,#11)", L"∆sus24(b9,#11)", Sus),
+	ChordPattern("111001101001", "M7sus24(b9,#11,b13)", L"∆sus24(b9,#11,b13)", Sus),
+	ChordPattern("111101000001", "M7sus24(b9,#9)", L"∆sus24(b9,#9)", Sus),
+	ChordPattern("111101100001", "M7sus24(b9,#9,#11)", L"∆sus24(b9,#9,#11)", Sus),
+	ChordPattern("111101100101", "M7sus24(b9,#9,#11,13)", L"∆sus24(b9,#9,#11,13)", Sus),
+	ChordPattern("111101101001", "M7sus24(b9,#9,#11,b13)", L"∆sus24alt", Sus),
+	ChordPattern("111101000101", "M7sus24(b9,#9,13)", L"∆sus24(b9,#9,13)", Sus),
+	ChordPattern("111101001001", "M7sus24(b9,#9,b13)", L"∆sus24(b9,#9,b13)", Sus),
+	ChordPattern("111001000101", "M7sus24(b9,13)", L"∆sus24(b9,13)", Sus),
+	ChordPattern("111001001001", "M7sus24(b9,b13)", L"∆sus24(b9,b13)", Sus),
+	ChordPattern("101001100000", "sus24(#11)", L"sus24(#11)", Sus),
+	ChordPattern("101001100100", "sus24(#11,13)", L"sus24(#11,13)", Sus),
+	ChordPattern("101001101000", "sus24(#11,b13)", L"sus24(#11,b13)", Sus),
+	ChordPattern("101101000000", "sus24(#9)", L"sus24(#9)", Sus),
+	ChordPattern("101101000100", "sus24(#9,13)", L"sus24(#9,13)", Sus),
+	ChordPattern("101001001000", "sus24(b13)", L"sus24(b13)", Sus),
+	ChordPattern("111001000000", "sus24(b9)", L"sus24(b9)", Sus),
+	ChordPattern("111001100000", "sus24(b9,#11)", L"sus24(b9,#11)", Sus),
+	ChordPattern("111001100100", "sus24(b9,#11,13)", L"sus24(b9,#11,13)", Sus),
+	ChordPattern("111001101000", "sus24(b9,#11,b13)", L"sus24(b9,#11,b13)", Sus),
+	ChordPattern("111101000000", "sus24(b9,#9)", L"sus24(b9,#9)", Sus),
+	ChordPattern("111101100000", "sus24(b9,#9,#11)", L"sus24(b9,#9,#11)", Sus),
+	ChordPattern("111101100100", "sus24(b9,#9,#11,13)", L"sus24(b9,#9,#11,13)", Sus),
+	ChordPattern("111101101000", "sus24(b9,#9,#11,b13)", L"sus24alt", Sus),
+	ChordPattern("111101000100", "sus24(b9,#9,13)", L"sus24(b9,#9,13)", Sus),
+	ChordPattern("111101001000", "sus24(b9,#9,b13)", L"sus24(b9,#9,b13)", Sus),
+	ChordPattern("111001000100", "sus24(b9,13)", L"sus24(b9,13)", Sus),
+	ChordPattern("111001001000", "sus24(b9,b13)", L"sus24(b9,b13)", Sus),
+	//major (no5)
+	ChordPattern("100010000000", "(no5)", L"(no5)", Major),
+	ChordPattern("100111000000", "(#9,11)(no5)", L"(#9,11)(no5)", Major),
+	ChordPattern("100111000100", "(#9,11,13)(no5)", L"(#9,11,13)(no5)", Major),
+	ChordPattern("100110000100", "(#9,13)(no5)", L"(#9,13)(no5)", Major),
+	ChordPattern("100011000100", "(11,13)(no5)", L"(11,13)(no5)", Major),
+	ChordPattern("101011000000", "(9,11)(no5)", L"(9,11)(no5)", Major),
+	ChordPattern("101011000100", "(9,11,13)(no5)", L"(9,11,13)(no5)", Major),
+	ChordPattern("101010000100", "(9,13)(no5)", L"(9,13)(no5)", Major),
+	ChordPattern("100110000000", "(add#9)(no5)", L"(add#9)(no5)", Major),
+	ChordPattern("100011000000", "(add11)(no5)", L"(add11)(no5)", Major),
+	ChordPattern("101010000000", "(add9)(no5)", L"(add9)(no5)", Major),
+	ChordPattern("110010000000", "(addb9)(no5)", L"(addb9)(no5)", Major),
+	ChordPattern("110110000000", "(b9,#9)(no5)", L"(b9,#9)(no5)", Major),
+	ChordPattern("110110100000", "(b9,#9,#11)(no5)", L"(b9,#9,#11)(no5)", Major),
+	ChordPattern("110110100100", "(b9,#9,#11,13)(no5)", L"(b9,#9,#11,13)(no5)", Major),
+	ChordPattern("110111000000", "(b9,#9,11)(no5)", L"(b9,#9,11)(no5)", Major),
+	ChordPattern("110111000100", "(b9,#9,11,13)(no5)", L"(b9,#9,11,13)(no5)", Major),
+	ChordPattern("110011000000", "(b9,11)(no5)", L"(b9,11)(no5)", Major),
+	ChordPattern("110011000100", "(b9,11,13)(no5)", L"(b9,11,13)(no5)", Major),
+	ChordPattern("110010000100", "(b9,13)(no5)", L"(b9,13)(no5)", Major),
+	ChordPattern("100111000010", "11(#9)(no5)", L"11(#9)(no5)", Major),
+	ChordPattern("101011000010", "11(no5)", L"11(no5)", Major),
+	ChordPattern("100111000110", "13(#9)(no5)", L"13(#9)(no5)", Major),
+	ChordPattern("110011000110", "13(b9)(no5)", L"13(b9)(no5)", Major),
+	ChordPattern("101011000110", "13(no5)", L"13(no5)", Major),
+	ChordPattern("100010000100", "6(no5)", L"6(no5)", Major),
+	ChordPattern("100110000010", "7(#9)(no5)", L"7(#9)(no5)", Major),
+	ChordPattern("100110000110", "7(#9,13)(no5)", L"7(#9,13)(no5)", Major),
+	ChordPattern("100011000010", "7(11)(no5)", L"7(11)(no5)", Major),
+	ChordPattern("100011000110", "7(11,13)(no5)", L"7(11,13)(no5)", Major),
+	ChordPattern("100010000110", "7(13)(no5)", L"7(13)(no5)", Major),
+	ChordPattern("110010000010", "7(b9)(no5)", L"7(b9)(no5)", Major),
+	ChordPattern("110011000010", "7(b9,11)(no5)", L"7(b9,11)(no5)", Major),
+	ChordPattern("110010000110", "7(b9,13)(no5)", L"7(b9,13)(no5)", Major),
+	ChordPattern("100010000010", "7(no5)", L"7(no5)", Major),
+	ChordPattern("101010000110", "9(13)(no5)", L"9(13)(no5)", Major),
+	ChordPattern("101010000010", "9(no5)", L"9(no5)", Major),
+	ChordPattern("100111000001", "M11(#9)(no5)", L"∆11(#9)(no5)", Major),
+	ChordPattern("101011000001", "M11(no5)", L"∆11(no5)", Major),
+	ChordPattern("100111000101", "M13(#9)(no5)", L"∆13(#9)(no5)", Major),
+	ChordPattern("110011000101", "M13(b9)(no5)", L"∆13(b9)(no5)", Major),
+	ChordPattern("101011000101", "M13(no5)", L"∆13(no5)", Major),
+	ChordPattern("100110000001", "M7(#9)(no5)", L"∆(#9)(no5)", Major),
+	ChordPattern("100110000101", "M7(#9,13)(no5)", L"∆(#9,13)(no5)", Major),
+	ChordPattern("100011000001", "M7(11)(no5)", L"∆(11)(no5)", Major),
+	ChordPattern("100011000101", "M7(11,13)(no5)", L"∆(11,13)(no5)", Major),
+	ChordPattern("100010000101", "M7(13)(no5)", L"∆(13)(no5)", Major),
+	ChordPattern("110010000001", "M7(b9)(no5)", L"∆(b9)(no5)", Major),
+	ChordPattern("110011000001", "M7(b9,11)(no5)", L"∆(b9,11)(no5)", Major),
+	ChordPattern("110010000101", "M7(b9,13)(no5)", L"∆(b9,13)(no5)", Major),
+	ChordPattern("100010000001", "M7(no5)", L"∆(no5)", Major),
+	ChordPattern("101010000101", "M9(13)(no5)", L"∆9(13)(no5)", Major),
+	ChordPattern("101010000001", "M9(no5)", L"∆9(no5)", Major),
+	//minor (no5)
+	ChordPattern("100100000000", "m(no5)", L"-(no5)", Minor),
+	ChordPattern("100101000100", "m(11,13)(no5)", L"-(11,13)(no5)", Minor),
+	ChordPattern("101100000100", "m(9,13)(no5)", L"-(9,13)(no5)", Minor),
+	ChordPattern("100101000000", "m(add11)(no5)", L"-(add11)(no5)", Minor),
+	ChordPattern("101100000000", "m(add9)(no5)", L"-(add9)(no5)", Minor),
+	ChordPattern("110100000000", "m(addb9)(no5)", L"-(addb9)(no5)", Minor),
+	ChordPattern("110101000000", "m(b9,11)(no5)", L"-(b9,11)(no5)", Minor),
+	ChordPattern("110101000100", "m(b9,11,13)(no5)", L"-(b9,11,13)(no5)", Minor),
+	ChordPattern("110100000100", "m(b9,13)(no5)", L"-(b9,13)(no5)", Minor),
+	ChordPattern("110101000101", "m(M13)(b9)(no5)", L"-∆13(b9)(no5)", Minor),
+	ChordPattern("100101000001", "m(M7)(11)(no5)", L"-∆(11)(no5)", Minor),
+	ChordPattern("100101000101", "m(M7)(11,13)(no5)", L"-∆(11,13)(no5)", Minor),
+	ChordPattern("100100000101", "m(M7)(13)(no5)", L"-∆(13)(no5)", Minor),
+	ChordPattern("110100000001", "m(M7)(b9)(no5)", L"-∆(b9)(no5)", Minor),
+	ChordPattern("110101000001", "m(M7)(b9,11)(no5)", L"-∆(b9,11)(no5)", Minor),
+	ChordPattern("110100000101", "m(M7)(b9,13)(no5)", L"-∆(b9,13)(no5)", Minor),
+	ChordPattern("100100000001", "m(M7)(no5)", L"-∆(no5)", Minor),
+	ChordPattern("101100000101", "m(M9)(13)(no5)", L"-∆9(13)(no5)", Minor),
+	ChordPattern("101100000001", "m(M9)(no5)", L"-∆9(no5)", Minor),
+	ChordPattern("110101000110", "m13(b9)(no5)", L"-13(b9)(no5)", Minor),
+	ChordPattern("100100000100", "m6(no5)", L"-6(no5)", Minor),
+	ChordPattern("100101000010", "m7(11)(no5)", L"-7(11)(no5)", Minor),
+	ChordPattern("100101000110", "m7(11,13)(no5)", L"-7(11,13)(no5)", Minor),
+	ChordPattern("100100000110", "m7(13)(no5)", L"-7(13)(no5)", Minor),
+	ChordPattern("110100000010", "m7(b9)(no5)", L"-7(b9)(no5)", Minor),
+	ChordPattern("110101000010", "m7(b9,11)(no5)", L"-7(b9,11)(no5)", Minor),
+	ChordPattern("110100000110", "m7(b9,13)(no5)", L"-7(b9,13)(no5)", Minor),
+	ChordPattern("100100000010", "m7(no5)", L"-7(no5)", Minor),
+	ChordPattern("101100000110", "m9(13)(no5)", L"-9(13)(no5)", Minor),
+	ChordPattern("101100000010", "m9(no5)", L"-9(no5)", Minor),
+	//suspended 2nd (no5)
+	ChordPattern("101000000000", "sus2(no5)", L"sus2(no5)", Sus),
+	ChordPattern("101000001100", "6sus2(b13)(no5)", L"6sus2(b13)(no5)", Sus),
+	ChordPattern("111000001100", "6sus2(b9,b13)(no5)", L"6sus2(b9,b13)(no5)", Sus),
+	ChordPattern("101000000110", "7sus2(13)(no5)", L"7sus2(13)(no5)", Sus),
+	ChordPattern("101000001110", "7sus2(6,b13)(no5)", L"7sus2(6,b13)(no5)", Sus),
+	ChordPattern("101000001010", "7sus2(b13)(no5)", L"7sus2(b13)(no5)", Sus),
+	ChordPattern("111000000010", "7sus2(b9)(no5)", L"7sus2(b9)(no5)", Sus),
+	ChordPattern("111000000110", "7sus2(b9,13)(no5)", L"7sus2(b9,13)(no5)", Sus),
+	ChordPattern("111000001010", "7sus2(b9,b13)(no5)", L"7sus2(b9,b13)(no5)", Sus),
+	ChordPattern("101000000010", "7sus2(no5)", L"7sus2(no5)", Sus),
+	ChordPattern("101000000101", "M7sus2(13)(no5)", L"∆sus2(13)(no5)", Sus),
+	ChordPattern("101000001101", "M7sus2(6,b13)(no5)", L"∆sus2(6,b13)(no5)", Sus),
+	ChordPattern("111000001101", "M7sus2(6,b9,b13)(no5)", L"∆sus2(6,b9,b13)(no5)", Sus),
+	ChordPattern("101000001001", "M7sus2(b13)(no5)", L"∆sus2(b13)(no5)", Sus),
+	ChordPattern("111000000001", "M7sus2(b9)(no5)", L"∆sus2(b9)(no5)", Sus),
+	ChordPattern("111000000101", "M7sus2(b9,13)(no5)", L"∆sus2(b9,13)(no5)", Sus),
+	ChordPattern("111000001001", "M7sus2(b9,b13)(no5)", L"∆sus2(b9,b13)(no5)", Sus),
+	ChordPattern("101000000001", "M7sus2(no5)", L"∆sus2(no5)", Sus),
+	ChordPattern("101000000100", "sus2(13)(no5)", L"sus2(13)(no5)", Sus),
+	ChordPattern("101000001000", "sus2(b13)(no5)", L"sus2(b13)(no5)", Sus),
+	ChordPattern("111000000000", "sus2(b9)(no5)", L"sus2(b9)(no5)", Sus),
+	ChordPattern("111100000000", "sus2(b9,#9)(no5)", L"sus2(b9,#9)(no5)", Sus),
+	ChordPattern("111100100000", "sus2(b9,#9,#11)(no5)", L"sus2(b9,#9,#11)(no5)", Sus),
+	ChordPattern("111100100100", "sus2(b9,#9,#11,13)(no5)", L"sus2(b9,#9,#11,13)(no5)", Sus),
+	ChordPattern("111100101000", "sus2(b9,#9,#11,b13)(no5)", L"sus2alt(no5)", Sus),
+	ChordPattern("111000000100", "sus2(b9,13)(no5)", L"sus2(b9,13)(no5)", Sus),
+	ChordPattern("111000001000", "sus2(b9,b13)(no5)", L"sus2(b9,b13)(no5)", Sus),
+	//suspended 4th (no5)
+	ChordPattern("100001000000", "sus4(no5)", L"sus4(no5)", Sus),
+	ChordPattern("100001001100", "6sus4(b13)(no5)", L"6sus4(b13)(no5)", Sus),
+	ChordPattern("110001001100", "6sus4(b9,b13)(no5)", L"6sus4(b9,b13)(no5)", Sus),
+	ChordPattern("100001100010", "7sus4(#11)(no5)", L"7sus4(#11)(no5)", Sus),
+	ChordPattern("100001100110", "7sus4(#11,13)(no5)", L"7sus4(#11,13)(no5)", Sus),
+	ChordPattern("100001101010", "7sus4(#11,b13)(no5)", L"7sus4(#11,b13)(no5)", Sus),
+	ChordPattern("100001000110", "7sus4(13)(no5)", L"7sus4(13)(no5)", Sus),
+	ChordPattern("100001101110", "7sus4(6,#11,b13)(no5)", L"7sus4(6,#11,b13)(no5)", Sus),
+	ChordPattern("100001001110", "7sus4(6,b13)(no5)", L"7sus4(6,b13)(no5)", Sus),
+	ChordPattern("110001101110", "7sus4(6,b9,#11,b13)(no5)", L"7sus4(6,b9,#11,b13)(no5)", Sus),
+	ChordPattern("100001001010", "7sus4(b13)(no5)", L"7sus4(b13)(no5)", Sus),
+	ChordPattern("110001000010", "7sus4(b9)(no5)", L"7sus4(b9)(no5)", Sus),
+	ChordPattern("110001100010", "7sus4(b9,#11)(no5)", L"7sus4(b9,#11)(no5)", Sus),
+	ChordPattern("110001101010", "7sus4(b9,#11,b13)(no5)", L"7sus4(b9,#11,b13)(no5)", Sus),
+	ChordPattern("110001000110", "7sus4(b9,13)(no5)", L"7sus4(b9,13)(no5)", Sus),
+	ChordPattern("110001001010", "7sus4(b9,b13)(no5)", L"7sus4(b9,b13)(no5)", Sus),
+	ChordPattern("100001000010", "7sus4(no5)", L"7sus4(no5)", Sus),
+	ChordPattern("100001100001", "M7sus4(#11)(no5)", L"∆sus4(#11)(no5)", Sus),
+	ChordPattern("100001100101", "M7sus4(#11,13)(no5)", L"∆sus4(#11,13)(no5)", Sus),
+	ChordPattern("100001101001", "M7sus4(#11,b13)(no5)", L"∆sus4(#11,b13)(no5)", Sus),
+	ChordPattern("100001000101", "M7sus4(13)(no5)", L"∆sus4(13)(no5)", Sus),
+	ChordPattern("100001101101", "M7sus4(6,#11,b13)(no5)", L"∆sus4(6,#11,b13)(no5)", Sus),
+	ChordPattern("100001001101", "M7sus4(6,b13)(no5)", L"∆sus4(6,b13)(no5)", Sus),
+	ChordPattern("110001101101", "M7sus4(6,b9,#11,b13)(no5)", L"∆sus4(6,b9,#11,b13)(no5)", Sus),
+	ChordPattern("110001001101", "M7sus4(6,b9,b13)(no5)", L"∆sus4(6,b9,b13)(no5)", Sus),
+	ChordPattern("100001001001", "M7sus4(b13)(no5)", L"∆sus4(b13)(no5)", Sus),
+	ChordPattern("110001000001", "M7sus4(b9)(no5)", L"∆sus4(b9)(no5)", Sus),
+	ChordPattern("110001100001", "M7sus4(b9,#11)(no5)", L"∆sus4(b9,#11)(no5)", Sus),
+	ChordPattern("110001101001", "M7sus4(b9,#11,b13)(no5)", L"∆sus4(b9,#11,b13)(no5)", Sus),
+	ChordPattern("110001000101", "M7sus4(b9,13)(no5)", L"∆sus4(b9,13)(no5)", Sus),
+	ChordPattern("110001001001", "M7sus4(b9,b13)(no5)", L"∆sus4(b9,b13)(no5)", Sus),
+	ChordPattern("100001000001", "M7sus4(no5)", L"∆sus4(no5)", Sus),
+	ChordPattern("100001100000", "sus4(#11)(no5)", L"sus4(#11)(no5)", Sus),
+	ChordPattern("100001100100", "sus4(#11,13)(no5)", L"sus4(#11,13)(no5)", Sus),
+	ChordPattern("100001101000", "sus4(#11,b13)(no5)", L"sus4(#11,b13)(no5)", Sus),
+	ChordPattern("100001000100", "sus4(13)(no5)", L"sus4(13)(no5)", Sus),
+	ChordPattern("100001001000", "sus4(b13)(no5)", L"sus4(b13)(no5)", Sus),
+	ChordPattern("110001100000", "sus4(b9,#11)(no5)", L"sus4(b9,#11)(no5)", Sus),
+	ChordPattern("110001100100", "sus4(b9,#11,13)(no5)", L"sus4(b9,#11,13)(no5)", Sus),
+	ChordPattern("110001101000", "sus4(b9,#11,b13)(no5)", L"sus4(b9,#11,b13)(no5)", Sus),
+	ChordPattern("110001000100", "sus4(b9,13)(no5)", L"sus4(b9,13)(no5)", Sus),
+	ChordPattern("110001001000", "sus4(b9,b13)(no5)", L"sus4(b9,b13)(no5)", Sus),
+	//major (no3)
+	ChordPattern("100000110100", "(#11,13)(no3)", L"(#11,13)(no3)", Major),
+	ChordPattern("100000111000", "(#11,b13)(no3)", L"(#11,b13)(no3)", Major),
+	ChordPattern("100000110000", "(add#11)(no3)", L"(add#11)(no3)", Major),
+	ChordPattern("100000011000", "(addb13)(no3)", L"(addb13)(no3)", Major),
+	ChordPattern("110000010000", "(addb9)(no3)", L"(addb9)(no3)", Major),
+	ChordPattern("100000100100", "(b5,13)(no3)", L"(b5,13)(no3)", Major),
+	ChordPattern("110000100000", "(b5,b9)(no3)", L"(b5,b9)(no3)", Major),
+	ChordPattern("110000100100", "(b5,b9,13)(no3)", L"(b5,b9,13)(no3)", Major),
+	ChordPattern("110000110000", "(b9,#11)(no3)", L"(b9,#11)(no3)", Major),
+	ChordPattern("110000110100", "(b9,#11,13)(no3)", L"(b9,#11,13)(no3)", Major),
+	ChordPattern("110000111000", "(b9,#11,b13)(no3)", L"(b9,#11,b13)(no3)", Major),
+	ChordPattern("110000010100", "(b9,13)(no3)", L"(b9,13)(no3)", Major),
+	ChordPattern("110000011000", "(b9,b13)(no3)", L"(b9,b13)(no3)", Major),
+	ChordPattern("110001100110", "13(b5,b9)(no3)", L"13(b5,b9)(no3)", Major),
+	ChordPattern("110000110110", "13(b9,#11)(no3)", L"13(b9,#11)(no3)", Major),
+	ChordPattern("100000111100", "6(#11,b13)(no3)", L"6(#11,b13)(no3)", Major),
+	ChordPattern("100000011100", "6(b13)(no3)", L"6(b13)(no3)", Major),
+	ChordPattern("100001101100", "6(b5,11,b13)(no3)", L"6(b5,11,b13)(no3)", Major),
+	ChordPattern("110001101100", "6(b5,b9,11,b13)(no3)", L"6(b5,b9,11,b13)(no3)", Major),
+	ChordPattern("110000011100", "6(b9,b13)(no3)", L"6(b9,b13)(no3)", Major),
+	ChordPattern("100000010100", "6(no3)", L"6(no3)", Major),
+	ChordPattern("100000110010", "7(#11)(no3)", L"7(#11)(no3)", Major),
+	ChordPattern("100000110110", "7(#11,13)(no3)", L"7(#11,13)(no3)", Major),
+	ChordPattern("100000111010", "7(#11,b13)(no3)", L"7(#11,b13)(no3)", Major),
+	ChordPattern("100000010110", "7(13)(no3)", L"7(13)(no3)", Major),
+	ChordPattern("100000111110", "7(6,#11,b13)(no3)", L"7(6,#11,b13)(no3)", Major),
+	ChordPattern("100000011110", "7(6,b13)(no3)", L"7(6,b13)(no3)", Major),
+	ChordPattern("110000111110", "7(6,b9,#11,b13)(no3)", L"7(6,b9,#11,b13)(no3)", Major),
+	ChordPattern("100000011010", "7(b13)(no3)", L"7(b13)(no3)", Major),
+	ChordPattern("100000100010", "7(b5)(no3)", L"7(b5)(no3)", Major),
+	ChordPattern("100000100110", "7(b5,13)(no3)", L"7(b5,13)(no3)", Major),
+	ChordPattern("110000100010", "7(b5,b9)(no3)", L"7(b5,b9)(no3)", Major),
+	ChordPattern("110000100110", "7(b5,b9,13)(no3)", L"7(b5,b9,13)(no3)", Major),
+	ChordPattern("110000010010", "7(b9)(no3)", L"7(b9)(no3)", Major),
+	ChordPattern("110000110010", "7(b9,#11)(no3)", L"7(b9,#11)(no3)", Major),
+	ChordPattern("110000111010", "7(b9,#11,b13)(no3)", L"7(b9,#11,b13)(no3)", Major),
+	ChordPattern("110000010110", "7(b9,13)(no3)", L"7(b9,13)(no3)", Major),
+	ChordPattern("110000011010", "7(b9,b13)(no3)", L"7(b9,b13)(no3)", Major),
+	ChordPattern("100000010010", "7(no3)", L"7(no3)", Major),
+	ChordPattern("110001100101", "M13(b5,b9)(no3)", L"∆13(b5,b9)(no3)", Major),
+	ChordPattern("110000110101", "M13(b9,#11)(no3)", L"∆13(b9,#11)(no3)", Major),
+	ChordPattern("100000110001", "M7(#11)(no3)", L"∆(#11)(no3)", Major),
+	ChordPattern("100000110101", "M7(#11,13)(no3)", L"∆(#11,13)(no3)", Major),
+	ChordPattern("100000111001", "M7(#11,b13)(no3)", L"∆(#11,b13)(no3)", Major),
+	ChordPattern("100000010101", "M7(13)(no3)", L"∆(13)(no3)", Major),
+	ChordPattern("100000111101", "M7(6,#11,b13)(no3)", L"∆(6,#11,b13)(no3)", Major),
+	ChordPattern("100000011101", "M7(6,b13)(no3)", L"∆(6,b13)(no3)", Major),
+	ChordPattern("110000111101", "M7(6,b9,#11,b13)(no3)", L"∆(6,b9,#11,b13)(no3)", Major),
+	ChordPattern("110000011101", "M7(6,b9,b13)(no3)", L"∆(6,b9,b13)(no3)", Major),
+	ChordPattern("100000011001", "M7(b13)(no3)", L"∆(b13)(no3)", Major),
+	ChordPattern("100000100001", "M7(b5)(no3)", L"∆(b5)(no3)", Major),
+	ChordPattern("100000100101", "M7(b5,13)(no3)", L"∆(b5,13)(no3)", Major),
+	ChordPattern("110000100001", "M7(b5,b9)(no3)", L"∆(b5,b9)(no3)", Major),
+	ChordPattern("110000100101", "M7(b5,b9,13)(no3)", L"∆(b5,b9,13)(no3)", Major),
+	ChordPattern("110000010001", "M7(b9)(no3)", L"∆(b9)(no3)", Major),
+	ChordPattern("110000110001", "M7(b9,#11)(no3)", L"∆(b9,#11)(no3)", Major),
+	ChordPattern("110000111001", "M7(b9,#11,b13)(no3)", L"∆(b9,#11,b13)(no3)", Major),
+	ChordPattern("110000010101", "M7(b9,13)(no3)", L"∆(b9,13)(no3)", Major),
+	ChordPattern("110000011001", "M7(b9,b13)(no3)", L"∆(b9,b13)(no3)", Major),
+	ChordPattern("100000010001", "M7(no3)", L"∆(no3)", Major),
+	//augmented (no3)
+	ChordPattern("100000001000", "aug(no3)", L"+(no3)", Aug),
+	ChordPattern("100000101100", "aug(#11,13)(no3)", L"+(#11,13)(no3)", Aug),
+	ChordPattern("100000101000", "aug(add#11)(no3)", L"+(add#11)(no3)", Aug),
+	ChordPattern("110000001000", "aug(addb9)(no3)", L"+(addb9)(no3)", Aug),
+	ChordPattern("110000101000", "aug(b9,#11)(no3)", L"+(b9,#11)(no3)", Aug),
+	ChordPattern("110000101100", "aug(b9,#11,13)(no3)", L"+(b9,#11,13)(no3)", Aug),
+	ChordPattern("110000001100", "aug(b9,13)(no3)", L"+(b9,13)(no3)", Aug),
+	ChordPattern("110000101101", "aug(M13)(b9,#11)(no3)", L"+∆13(b9,#11)(no3)", Aug),
+	ChordPattern("100000101001", "aug(M7)(#11)(no3)", L"+∆(#11)(no3)", Aug),
+	ChordPattern("100000101101", "aug(M7)(#11,13)(no3)", L"+∆(#11,13)(no3)", Aug),
+	ChordPattern("100000001101", "aug(M7)(13)(no3)", L"+∆(13)(no3)", Aug),
+	ChordPattern("110000001001", "aug(M7)(b9)(no3)", L"+∆(b9)(no3)", Aug),
+	ChordPattern("110000101001", "aug(M7)(b9,#11)(no3)", L"+∆(b9,#11)(no3)", Aug),
+	ChordPattern("110000001101", "aug(M7)(b9,13)(no3)", L"+∆(b9,13)(no3)", Aug),
+	ChordPattern("100000001001", "aug(M7)(no3)", L"+∆(no3)", Aug),
+	ChordPattern("110001001110", "aug13(b9)(no3)", L"+13(b9)(no3)", Aug),
+	ChordPattern("110000101110", "aug13(b9,#11)(no3)", L"+13(b9,#11)(no3)", Aug),
+	ChordPattern("100000001100", "aug6(no3)", L"+6(no3)", Aug),
+	ChordPattern("100000101010", "aug7(#11)(no3)", L"+7(#11)(no3)", Aug),
+	ChordPattern("100000101110", "aug7(#11,13)(no3)", L"+7(#11,13)(no3)", Aug),
+	ChordPattern("100000001110", "aug7(13)(no3)", L"+7(13)(no3)", Aug),
+	ChordPattern("110000001010", "aug7(b9)(no3)", L"+7(b9)(no3)", Aug),
+	ChordPattern("110000101010", "aug7(b9,#11)(no3)", L"+7(b9,#11)(no3)", Aug),
+	ChordPattern("110000001110", "aug7(b9,13)(no3)", L"+7(b9,13)(no3)", Aug),
+	ChordPattern("100000001010", "aug7(no3)", L"+7(no3)", Aug),
+	//easter egg
+	ChordPattern("111111111111", "-Easter Egg", L"Easter Egg", EasterEgg),
+};
+
+static constexpr int numPatterns = sizeof(patternList) / sizeof(patternList[0]);
+
+static constexpr std::array<int16, 4096> createPatternLookup()
+{
+	std::array<int16, 4096> patternLookup {};
+	for (int i = 0; i < 4096; i++)
+		patternLookup[i] = -1;
+
+	for (int patternIndex = 0; patternIndex < numPatterns; patternIndex++)
 	{
-		//intervals
-		ChordPattern("100000100000", " tritone", L" tritone", Tritonic),
-		ChordPattern("100000010000", "5", L"5", Major),
-		//major
-		ChordPattern("100010010000", "", L"", Major),
-		ChordPattern("100010010100", "6", L"6", Major),
-		ChordPattern("100010010010", "7", L"7", Major),
-		ChordPattern("101010010010", "9", L"9", Major),
-		ChordPattern("101011010010", "11", L"11", Major),
-		ChordPattern("101011010110", "13", L"13", Major),
-		ChordPattern("100010110100", "(#11,13)", L"(#11,13)", Major),
-		ChordPattern("100010111000", "(#11,b13)", L"(#11,b13)", Major),
-		ChordPattern("100110110000", "(#9,#11)", L"(#9,#11)", Major),
-		ChordPattern("100110110100", "(#9,#11,13)", L"(#9,#11,13)", Major),
-		ChordPattern("100110111000", "(#9,#11,b13)", L"(#9,#11,b13)", Major),
-		ChordPattern("100111010000", "(#9,11)", L"(#9,11)", Major),
-		ChordPattern("100111010100", "(#9,11,13)", L"(#9,11,13)", Major),
-		ChordPattern("100111011000", "(#9,11,b13)", L"(#9,11,b13)", Major),
-		ChordPattern("100110010100", "(#9,13)", L"(#9,13)", Major),
-		ChordPattern("100110011000", "(#9,b13)", L"(#9,b13)", Major),
-		ChordPattern("100011010100", "(11,13)", L"(11,13)", Major),
-		ChordPattern("100011011000", "(11,b13)", L"(11,b13)", Major),
-		ChordPattern("101010110000", "(9,#11)", L"(9,#11)", Major),
-		ChordPattern("101010110100", "(9,#11,13)", L"(9,#11,13)", Major),
-		ChordPattern("101010111000", "(9,#11,b13)", L"(9,#11,b13)", Major),
-		ChordPattern("101011010000", "(9,11)", L"(9,11)", Major),
-		ChordPattern("101011010100", "(9,11,13)", L"(9,11,13)", Major),
-		ChordPattern("101011011000", "(9,11,b13)", L"(9,11,b13)", Major),
-		ChordPattern("101010010100", "(9,13)", L"(9,13)", Major),
-		ChordPattern("101010011000", "(9,b13)", L"(9,b13)", Major),
-		ChordPattern("100010110000", "(add#11)", L"(add#11)", Major),
-		ChordPattern("100110010000", "(add#9)", L"(add#9)", Major),
-		ChordPattern("100011010000", "(add11)", L"(add11)", Major),
-		ChordPattern("101010010000", "(add9)", L"(add9)", Major),
-		ChordPattern("100010011000", "(addb13)", L"(addb13)", Major),
-		ChordPattern("110010010000", "(addb9)", L"(addb9)", Major),
-		ChordPattern("100010100000", "(b5)", L"(b5)", Major),
-		ChordPattern("100110100000", "(b5,#9)", L"(b5,#9)", Major),
-		ChordPattern("100111100000", "(b5,#9,11)", L"(b5,#9,11)", Major),
-		ChordPattern("100111100100", "(b5,#9,11,13)", L"(b5,#9,11,13)", Major),
-		ChordPattern("100111101000", "(b5,#9,11,b13)", L"(b5,#9,11,b13)", Major),
-		ChordPattern("100110100100", "(b5,#9,13)", L"(b5,#9,13)", Major),
-		ChordPattern("100011100000", "(b5,11)", L"(b5,11)", Major),
-		ChordPattern("100011100100", "(b5,11,13)", L"(b5,11,13)", Major),
-		ChordPattern("100011101000", "(b5,11,b13)", L"(b5,11,b13)", Major),
-		ChordPattern("100010100100", "(b5,13)", L"(b5,13)", Major),
-		ChordPattern("101010100000", "(b5,9)", L"(b5,9)", Major),
-		ChordPattern("101011100000", "(b5,9,11)", L"(b5,9,11)", Major),
-		ChordPattern("101011100100", "(b5,9,11,13)", L"(b5,9,11,13)", Major),
-		ChordPattern("101011101000", "(b5,9,11,b13)", L"(b5,9,11,b13)", Major),
-		ChordPattern("101010100100", "(b5,9,13)", L"(b5,9,13)", Major),
-		ChordPattern("110010100000", "(b5,b9)", L"(b5,b9)", Major),
-		ChordPattern("110011100000", "(b5,b9,11)", L"(b5,b9,11)", Major),
-		ChordPattern("110011100100", "(b5,b9,11,13)", L"(b5,b9,11,13)", Major),
-		ChordPattern("110011101000", "(b5,b9,11,b13)", L"(b5,b9,11,b13)", Major),
-		ChordPattern("110010100100", "(b5,b9,13)", L"(b5,b9,13)", Major),
-		ChordPattern("110010110000", "(b9,#11)", L"(b9,#11)", Major),
-		ChordPattern("110010110100", "(b9,#11,13)", L"(b9,#11,13)", Major),
-		ChordPattern("110010111000", "(b9,#11,b13)", L"(b9,#11,b13)", Major),
-		ChordPattern("110110010000", "(b9,#9)", L"(b9,#9)", Major),
-		ChordPattern("110110110000", "(b9,#9,#11)", L"(b9,#9,#11)", Major),
-		ChordPattern("110110110100", "(b9,#9,#11,13)", L"(b9,#9,#11,13)", Major),
-		ChordPattern("110110111000", "(b9,#9,#11,b13)", L"alt", Major),
-		ChordPattern("110111010000", "(b9,#9,11)", L"(b9,#9,11)", Major),
-		ChordPattern("110111010100", "(b9,#9,11,13)", L"(b9,#9,11,13)", Major),
-		ChordPattern("110111011000", "(b9,#9,11,b13)", L"(b9,#9,11,b13)", Major),
-		ChordPattern("110011010000", "(b9,11)", L"(b9,11)", Major),
-		ChordPattern("110011010100", "(b9,11,13)", L"(b9,11,13)", Major),
-		ChordPattern("110011011000", "(b9,11,b13)", L"(b9,11,b13)", Major),
-		ChordPattern("110010010100", "(b9,13)", L"(b9,13)", Major),
-		ChordPattern("110010011000", "(b9,b13)", L"(b9,b13)", Major),
-		ChordPattern("100111010010", "11(#9)", L"11(#9)", Major),
-		ChordPattern("100111011010", "11(#9,b13)", L"11(#9,b13)", Major),
-		ChordPattern("100111011110", "11(6,#9,b13)", L"11(6,#9,b13)", Major),
-		ChordPattern("101011011110", "11(6,b13)", L"11(6,b13)", Major),
-		ChordPattern("101011011010", "11(b13)", L"11(b13)", Major),
-		ChordPattern("101011100010", "11(b5)", L"11(b5)", Major),
-		ChordPattern("100111100010", "11(b5,#9)", L"11(b5,#9)", Major),
-		ChordPattern("100111101010", "11(b5,#9,b13)", L"11(b5,#9,b13)", Major),
-		ChordPattern("100111101110", "11(b5,6,#9,b13)", L"11(b5,6,#9,b13)", Major),
-		ChordPattern("101011101110", "11(b5,6,b13)", L"11(b5,6,b13)", Major),
-		ChordPattern("101011101010", "11(b5,b13)", L"11(b5,b13)", Major),
-		ChordPattern("110011101010", "11(b5,b9,b13)", L"11(b5,b9,b13)", Major),
-		ChordPattern("110011011010", "11(b9,b13)", L"11(b9,b13)", Major),
-		ChordPattern("101010110110", "13(#11)", L"13(#11)", Major),
-		ChordPattern("100111010110", "13(#9)", L"13(#9)", Major),
-		ChordPattern("100110110110", "13(#9,#11)", L"13(#9,#11)", Major),
-		ChordPattern("101011100110", "13(b5)", L"13(b5)", Major),
-		ChordPattern("100111100110", "13(b5,#9)", L"13(b5,#9)", Major),
-		ChordPattern("110011100110", "13(b5,b9)", L"13(b5,b9)", Major),
-		ChordPattern("110011010110", "13(b9)", L"13(b9)", Major),
-		ChordPattern("110010110110", "13(b9,#11)", L"13(b9,#11)", Major),
-		ChordPattern("100010111100", "6(#11,b13)", L"6(#11,b13)", Major),
-		ChordPattern("100110111100", "6(#9,#11,b13)", L"6(#9,#11,b13)", Major),
-		ChordPattern("100111011100", "6(#9,11,b13)", L"6(#9,11,b13)", Major),
-		ChordPattern("100110011100", "6(#9,b13)", L"6(#9,b13)", Major),
-		ChordPattern("100011011100", "6(11,b13)", L"6(11,b13)", Major),
-		ChordPattern("101010111100", "6(9,#11,b13)", L"6(9,#11,b13)", Major),
-		ChordPattern("101011011100", "6(9,11,b13)", L"6(9,11,b13)", Major),
-		ChordPattern("101010011100", "6(9,b13)", L"6(9,b13)", Major),
-		ChordPattern("100010011100", "6(b13)", L"6(b13)", Major),
-		ChordPattern("100111101100", "6(b5,#9,11,b13)", L"6(b5,#9,11,b13)", Major),
-		ChordPattern("100011101100", "6(b5,11,b13)", L"6(b5,11,b13)", Major),
-		ChordPattern("101011101100", "6(b5,9,11,b13)", L"6(b5,9,11,b13)", Major),
-		ChordPattern("110011101100", "6(b5,b9,11,b13)", L"6(b5,b9,11,b13)", Major),
-		ChordPattern("110011011100", "6(b9,11,b13)", L"6(b9,11,b13)", Major),
-		ChordPattern("110010011100", "6(b9,b13)", L"6(b9,b13)", Major),
-		ChordPattern("100010110010", "7(#11)", L"7(#11)", Major),
-		ChordPattern("100010110110", "7(#11,13)", L"7(#11,13)", Major),
-		ChordPattern("100010111010", "7(#11,b13)", L"7(#11,b13)", Major),
-		ChordPattern("100110010010", "7(#9)", L"7(#9)", Major),
-		ChordPattern("100110110010", "7(#9,#11)", L"7(#9,#11)", Major),
-		ChordPattern("100110111010", "7(#9,#11,b13)", L"7(#9,#11,b13)", Major),
-		ChordPattern("100110010110", "7(#9,13)", L"7(#9,13)", Major),
-		ChordPattern("100110011010", "7(#9,b13)", L"7(#9,b13)", Major),
-		ChordPattern("100011010010", "7(11)", L"7(11)", Major),
-		ChordPattern("100011010110", "7(11,13)", L"7(11,13)", Major),
-		ChordPattern("100011011010", "7(11,b13)", L"7(11,b13)", Major),
-		ChordPattern("100010010110", "7(13)", L"7(13)", Major),
-		ChordPattern("100010111110", "7(6,#11,b13)", L"7(6,#11,b13)", Major),
-		ChordPattern("100110111110", "7(6,#9,#11,b13)", L"7(6,#9,#11,b13)", Major),
-		ChordPattern("100110011110", "7(6,#9,b13)", L"7(6,#9,b13)", Major),
-		ChordPattern("100011011110", "7(6,11,b13)", L"7(6,11,b13)", Major),
-		ChordPattern("101010011110", "7(6,9,b13)", L"7(6,9,b13)", Major),
-		ChordPattern("100010011110", "7(6,b13)", L"7(6,b13)", Major),
-		ChordPattern("110010111110", "7(6,b9,#11,b13)", L"7(6,b9,#11,b13)", Major),
-		ChordPattern("100010011010", "7(b13)", L"7(b13)", Major),
-		ChordPattern("100010100010", "7(b5)", L"7(b5)", Major),
-		ChordPattern("100110100010", "7(b5,#9)", L"7(b5,#9)", Major),
-		ChordPattern("100110100110", "7(b5,#9,13)", L"7(b5,#9,13)", Major),
-		ChordPattern("100011100010", "7(b5,11)", L"7(b5,11)", Major),
-		ChordPattern("100011100110", "7(b5,11,13)", L"7(b5,11,13)", Major),
-		ChordPattern("100011101010", "7(b5,11,b13)", L"7(b5,11,b13)", Major),
-		ChordPattern("100010100110", "7(b5,13)", L"7(b5,13)", Major),
-		ChordPattern("100011101110", "7(b5,6,11,b13)", L"7(b5,6,11,b13)", Major),
-		ChordPattern("110010100010", "7(b5,b9)", L"7(b5,b9)", Major),
-		ChordPattern("110011100010", "7(b5,b9,11)", L"7(b5,b9,11)", Major),
-		ChordPattern("110010100110", "7(b5,b9,13)", L"7(b5,b9,13)", Major),
-		ChordPattern("110010010010", "7(b9)", L"7(b9)", Major),
-		ChordPattern("110010110010", "7(b9,#11)", L"7(b9,#11)", Major),
-		ChordPattern("110010111010", "7(b9,#11,b13)", L"7(b9,#11,b13)", Major),
-		ChordPattern("110110010010", "7(b9,#9)", L"7(b9,#9)", Major),
-		ChordPattern("110110110010", "7(b9,#9,#11)", L"7(b9,#9,#11)", Major),
-		ChordPattern("110110110110", "7(b9,#9,#11,13)", L"7(b9,#9,#11,13)", Major),
-		ChordPattern("110110111010", "7(b9,#9,#11,b13)", L"7alt", Major),
-		ChordPattern("110111010010", "7(b9,#9,11)", L"7(b9,#9,11)", Major),
-		ChordPattern("110111010110", "7(b9,#9,11,13)", L"7(b9,#9,11,13)", Major),
-		ChordPattern("110111011010", "7(b9,#9,11,b13)", L"7(b9,#9,11,b13)", Major),
-		ChordPattern("110011010010", "7(b9,11)", L"7(b9,11)", Major),
-		ChordPattern("110010010110", "7(b9,13)", L"7(b9,13)", Major),
-		ChordPattern("110010011010", "7(b9,b13)", L"7(b9,b13)", Major),
-		ChordPattern("101010110010", "9(#11)", L"9(#11)", Major),
-		ChordPattern("101010111010", "9(#11,b13)", L"9(#11,b13)", Major),
-		ChordPattern("101010010110", "9(13)", L"9(13)", Major),
-		ChordPattern("101010111110", "9(6,#11,b13)", L"9(6,#11,b13)", Major),
-		ChordPattern("101010011010", "9(b13)", L"9(b13)", Major),
-		ChordPattern("101010100010", "9(b5)", L"9(b5)", Major),
-		ChordPattern("101010100110", "9(b5,13)", L"9(b5,13)", Major),
-		ChordPattern("101011010001", "M11", L"∆11", Major),
-		ChordPattern("100111010001", "M11(#9)", L"∆11(#9)", Major),
-		ChordPattern("100111011001", "M11(#9,b13)", L"∆11(#9,b13)", Major),
-		ChordPattern("100111011101", "M11(6,#9,b13)", L"∆11(6,#9,b13)", Major),
-		ChordPattern("101011011101", "M11(6,b13)", L"∆11(6,b13)", Major),
-		ChordPattern("110011011101", "M11(6,b9,b13)", L"∆11(6,b9,b13)", Major),
-		ChordPattern("101011011001", "M11(b13)", L"∆11(b13)", Major),
-		ChordPattern("101011100001", "M11(b5)", L"∆11(b5)", Major),
-		ChordPattern("100111100001", "M11(b5,#9)", L"∆11(b5,#9)", Major),
-		ChordPattern("100111101001", "M11(b5,#9,b13)", L"∆11(b5,#9,b13)", Major),
-		ChordPattern("100111101101", "M11(b5,6,#9,b13)", L"∆11(b5,6,#9,b13)", Major),
-		ChordPattern("101011101101", "M11(b5,6,b13)", L"∆11(b5,6,b13)", Major),
-		ChordPattern("110011101101", "M11(b5,6,b9,b13)", L"∆11(b5,6,b9,b13)", Major),
-		ChordPattern("101011101001", "M11(b5,b13)", L"∆11(b5,b13)", Major),
-		ChordPattern("110011101001", "M11(b5,b9,b13)", L"∆11(b5,b9,b13)", Major),
-		ChordPattern("110011011001", "M11(b9,b13)", L"∆11(b9,b13)", Major),
-		ChordPattern("101011010101", "M13", L"∆13", Major),
-		ChordPattern("101010110101", "M13(#11)", L"∆13(#11)", Major),
-		ChordPattern("100111010101", "M13(#9)", L"∆13(#9)", Major),
-		ChordPattern("100110110101", "M13(#9,#11)", L"∆13(#9,#11)", Major),
-		ChordPattern("101011100101", "M13(b5)", L"∆13(b5)", Major),
-		ChordPattern("100111100101", "M13(b5,#9)", L"∆13(b5,#9)", Major),
-		ChordPattern("110011100101", "M13(b5,b9)", L"∆13(b5,b9)", Major),
-		ChordPattern("110011010101", "M13(b9)", L"∆13(b9)", Major),
-		ChordPattern("110010110101", "M13(b9,#11)", L"∆13(b9,#11)", Major),
-		ChordPattern("100010010001", "M7", L"∆", Major),
-		ChordPattern("100010110001", "M7(#11)", L"∆(#11)", Major),
-		ChordPattern("100010110101", "M7(#11,13)", L"∆(#11,13)", Major),
-		ChordPattern("100010111001", "M7(#11,b13)", L"∆(#11,b13)", Major),
-		ChordPattern("100110010001", "M7(#9)", L"∆(#9)", Major),
-		ChordPattern("100110110001", "M7(#9,#11)", L"∆(#9,#11)", Major),
-		ChordPattern("100110111001", "M7(#9,#11,b13)", L"∆(#9,#11,b13)", Major),
-		ChordPattern("100110010101", "M7(#9,13)", L"∆(#9,13)", Major),
-		ChordPattern("100110011001", "M7(#9,b13)", L"∆(#9,b13)", Major),
-		ChordPattern("100011010001", "M7(11)", L"∆(11)", Major),
-		ChordPattern("100011010101", "M7(11,13)", L"∆(11,13)", Major),
-		ChordPattern("100011011001", "M7(11,b13)", L"∆(11,b13)", Major),
-		ChordPattern("100010010101", "M7(13)", L"∆(13)", Major),
-		ChordPattern("100010111101", "M7(6,#11,b13)", L"∆(6,#11,b13)", Major),
-		ChordPattern("100110111101", "M7(6,#9,#11,b13)", L"∆(6,#9,#11,b13)", Major),
-		ChordPattern("100110011101", "M7(6,#9,b13)", L"∆(6,#9,b13)", Major),
-		ChordPattern("100011011101", "M7(6,11,b13)", L"∆(6,11,b13)", Major),
-		ChordPattern("101010011101", "M7(6,9,b13)", L"∆(6,9,b13)", Major),
-		ChordPattern("100010011101", "M7(6,b13)", L"∆(6,b13)", Major),
-		ChordPattern("110010111101", "M7(6,b9,#11,b13)", L"∆(6,b9,#11,b13)", Major),
-		ChordPattern("110010011101", "M7(6,b9,b13)", L"∆(6,b9,b13)", Major),
-		ChordPattern("100010011001", "M7(b13)", L"∆(b13)", Major),
-		ChordPattern("100010100001", "M7(b5)", L"∆(b5)", Major),
-		ChordPattern("100110100001", "M7(b5,#9)", L"∆(b5,#9)", Major),
-		ChordPattern("100110100101", "M7(b5,#9,13)", L"∆(b5,#9,13)", Major),
-		ChordPattern("100011100001", "M7(b5,11)", L"∆(b5,11)", Major),
-		ChordPattern("100011100101", "M7(b5,11,13)", L"∆(b5,11,13)", Major),
-		ChordPattern("100011101001", "M7(b5,11,b13)", L"∆(b5,11,b13)", Major),
-		ChordPattern("100010100101", "M7(b5,13)", L"∆(b5,13)", Major),
-		ChordPattern("100011101101", "M7(b5,6,11,b13)", L"∆(b5,6,11,b13)", Major),
-		ChordPattern("110010100001", "M7(b5,b9)", L"∆(b5,b9)", Major),
-		ChordPattern("110011100001", "M7(b5,b9,11)", L"∆(b5,b9,11)", Major),
-		ChordPattern("110010100101", "M7(b5,b9,13)", L"∆(b5,b9,13)", Major),
-		ChordPattern("110010010001", "M7(b9)", L"∆(b9)", Major),
-		ChordPattern("110010110001", "M7(b9,#11)", L"∆(b9,#11)", Major),
-		ChordPattern("110010111001", "M7(b9,#11,b13)", L"∆(b9,#11,b13)", Major),
-		ChordPattern("110110010001", "M7(b9,#9)", L"∆(b9,#9)", Major),
-		ChordPattern("110110110001", "M7(b9,#9,#11)", L"∆(b9,#9,#11)", Major),
-		ChordPattern("110110110101", "M7(b9,#9,#11,13)", L"∆(b9,#9,#11,13)", Major),
-		ChordPattern("110110111001", "M7(b9,#9,#11,b13)", L"∆alt", Major),
-		ChordPattern("110111010001", "M7(b9,#9,11)", L"∆(b9,#9,11)", Major),
-		ChordPattern("110111010101", "M7(b9,#9,11,13)", L"∆(b9,#9,11,13)", Major),
-		ChordPattern("110111011001", "M7(b9,#9,11,b13)", L"∆(b9,#9,11,b13)", Major),
-		ChordPattern("110011010001", "M7(b9,11)", L"∆(b9,11)", Major),
-		ChordPattern("110010010101", "M7(b9,13)", L"∆(b9,13)", Major),
-		ChordPattern("110010011001", "M7(b9,b13)", L"∆(b9,b13)", Major),
-		ChordPattern("101010010001", "M9", L"∆9", Major),
-		ChordPattern("101010110001", "M9(#11)", L"∆9(#11)", Major),
-		ChordPattern("101010111001", "M9(#11,b13)", L"∆9(#11,b13)", Major),
-		ChordPattern("101010010101", "M9(13)", L"∆9(13)", Major),
-		ChordPattern("101010111101", "M9(6,#11,b13)", L"∆9(6,#11,b13)", Major),
-		ChordPattern("101010011001", "M9(b13)", L"∆9(b13)", Major),
-		ChordPattern("101010100001", "M9(b5)", L"∆9(b5)", Major),
-		ChordPattern("101010100101", "M9(b5,13)", L"∆9(b5,13)", Major),
-		//minor
-		ChordPattern("100100010000", "m", L"-", Minor),
-		ChordPattern("100100110100", "m(#11,13)", L"-(#11,13)", Minor),
-		ChordPattern("100100111000", "m(#11,b13)", L"-(#11,b13)", Minor),
-		ChordPattern("100100001000", "m(#5)", L"-(#5)", Minor),
-		ChordPattern("100101001000", "m(#5,11)", L"-(#5,11)", Minor),
-		ChordPattern("100101001100", "m(#5,11,13)", L"-(#5,11,13)", Minor),
-		ChordPattern("100100001100", "m(#5,13)", L"-(#5,13)", Minor),
-		ChordPattern("101100001000", "m(#5,9)", L"-(#5,9)", Minor),
-		ChordPattern("101101001000", "m(#5,9,11)", L"-(#5,9,11)", Minor),
-		ChordPattern("101101001100", "m(#5,9,11,13)", L"-(#5,9,11,13)", Minor),
-		ChordPattern("101100001100", "m(#5,9,13)", L"-(#5,9,13)", Minor),
-		ChordPattern("110100001000", "m(#5,b9)", L"-(#5,b9)", Minor),
-		ChordPattern("110101001000", "m(#5,b9,11)", L"-(#5,b9,11)", Minor),
-		ChordPattern("110101001100", "m(#5,b9,11,13)", L"-(#5,b9,11,13)", Minor),
-		ChordPattern("100101010100", "m(11,13)", L"-(11,13)", Minor),
-		ChordPattern("100101011000", "m(11,b13)", L"-(11,b13)", Minor),
-		ChordPattern("101100110000", "m(9,#11)", L"-(9,#11)", Minor),
-		ChordPattern("101100110100", "m(9,#11,13)", L"-(9,#11,13)", Minor),
-		ChordPattern("101100111000", "m(9,#11,b13)", L"-(9,#11,b13)", Minor),
-		ChordPattern("101101010000", "m(9,11)", L"-(9,11)", Minor),
-		ChordPattern("101101010100", "m(9,11,13)", L"-(9,11,13)", Minor),
-		ChordPattern("101101011000", "m(9,11,b13)", L"-(9,11,b13)", Minor),
-		ChordPattern("101100010100", "m(9,13)", L"-(9,13)", Minor),
-		ChordPattern("101100011000", "m(9,b13)", L"-(9,b13)", Minor),
-		ChordPattern("100100110000", "m(add#11)", L"-(add#11)", Minor),
-		ChordPattern("100101010000", "m(add11)", L"-(add11)", Minor),
-		ChordPattern("101100010000", "m(add9)", L"-(add9)", Minor),
-		ChordPattern("100100011000", "m(addb13)", L"-(addb13)", Minor),
-		ChordPattern("110100010000", "m(addb9)", L"-(addb9)", Minor),
-		ChordPattern("110100110000", "m(b9,#11)", L"-(b9,#11)", Minor),
-		ChordPattern("110100110100", "m(b9,#11,13)", L"-(b9,#11,13)", Minor),
-		ChordPattern("110100111000", "m(b9,#11,b13)", L"-(b9,#11,b13)", Minor),
-		ChordPattern("110101010000", "m(b9,11)", L"-(b9,11)", Minor),
-		ChordPattern("110101010100", "m(b9,11,13)", L"-(b9,11,13)", Minor),
-		ChordPattern("110101011000", "m(b9,11,b13)", L"-(b9,11,b13)", Minor),
-		ChordPattern("110100010100", "m(b9,13)", L"-(b9,13)", Minor),
-		ChordPattern("110100011000", "m(b9,b13)", L"-(b9,b13)", Minor),
-		ChordPattern("101101010001", "m(M11)", L"-∆11", Minor),
-		ChordPattern("101101001001", "m(M11)(#5)", L"-∆11(#5)", Minor),
-		ChordPattern("110101001001", "m(M11)(#5,b9)", L"-∆11(#5,b9)", Minor),
-		ChordPattern("101101011101", "m(M11)(6,b13)", L"-∆11(6,b13)", Minor),
-		ChordPattern("110101011101", "m(M11)(6,b9,b13)", L"-∆11(6,b9,b13)", Minor),
-		ChordPattern("101101011001", "m(M11)(b13)", L"-∆11(b13)", Minor),
-		ChordPattern("110101011001", "m(M11)(b9,b13)", L"-∆11(b9,b13)", Minor),
-		ChordPattern("101101010101", "m(M13)", L"-∆13", Minor),
-		ChordPattern("101100110101", "m(M13)(#11)", L"-∆13(#11)", Minor),
-		ChordPattern("101101001101", "m(M13)(#5)", L"-∆13(#5)", Minor),
-		ChordPattern("110101001101", "m(M13)(#5,b9)", L"-∆13(#5,b9)", Minor),
-		ChordPattern("110101010101", "m(M13)(b9)", L"-∆13(b9)", Minor),
-		ChordPattern("110100110101", "m(M13)(b9,#11)", L"-∆13(b9,#11)", Minor),
-		ChordPattern("100100010001", "m(M7)", L"-∆", Minor),
-		ChordPattern("100100110001", "m(M7)(#11)", L"-∆(#11)", Minor),
-		ChordPattern("100100110101", "m(M7)(#11,13)", L"-∆(#11,13)", Minor),
-		ChordPattern("100100111001", "m(M7)(#11,b13)", L"-∆(#11,b13)", Minor),
-		ChordPattern("100100001001", "m(M7)(#5)", L"-∆(#5)", Minor),
-		ChordPattern("100101001001", "m(M7)(#5,11)", L"-∆(#5,11)", Minor),
-		ChordPattern("100101001101", "m(M7)(#5,11,13)", L"-∆(#5,11,13)", Minor),
-		ChordPattern("100100001101", "m(M7)(#5,13)", L"-∆(#5,13)", Minor),
-		ChordPattern("110100001001", "m(M7)(#5,b9)", L"-∆(#5,b9)", Minor),
-		ChordPattern("110100001101", "m(M7)(#5,b9,13)", L"-∆(#5,b9,13)", Minor),
-		ChordPattern("100101010001", "m(M7)(11)", L"-∆(11)", Minor),
-		ChordPattern("100101010101", "m(M7)(11,13)", L"-∆(11,13)", Minor),
-		ChordPattern("100101011001", "m(M7)(11,b13)", L"-∆(11,b13)", Minor),
-		ChordPattern("100100010101", "m(M7)(13)", L"-∆(13)", Minor),
-		ChordPattern("100100111101", "m(M7)(6,#11,b13)", L"-∆(6,#11,b13)", Minor),
-		ChordPattern("100101011101", "m(M7)(6,11,b13)", L"-∆(6,11,b13)", Minor),
-		ChordPattern("100100011101", "m(M7)(6,b13)", L"-∆(6,b13)", Minor),
-		ChordPattern("110100111101", "m(M7)(6,b9,#11,b13)", L"-∆(6,b9,#11,b13)", Minor),
-		ChordPattern("110100011101", "m(M7)(6,b9,b13)", L"-∆(6,b9,b13)", Minor),
-		ChordPattern("100100011001", "m(M7)(b13)", L"-∆(b13)", Minor),
-		ChordPattern("110100010001", "m(M7)(b9)", L"-∆(b9)", Minor),
-		ChordPattern("110100110001", "m(M7)(b9,#11)", L"-∆(b9,#11)", Minor),
-		ChordPattern("110100111001", "m(M7)(b9,#11,b13)", L"-∆(b9,#11,b13)", Minor),
-		ChordPattern("110101010001", "m(M7)(b9,11)", L"-∆(b9,11)", Minor),
-		ChordPattern("110100010101", "m(M7)(b9,13)", L"-∆(b9,13)", Minor),
-		ChordPattern("110100011001", "m(M7)(b9,b13)", L"-∆(b9,b13)", Minor),
-		ChordPattern("101100010001", "m(M9)", L"-∆9", Minor),
-		ChordPattern("101100110001", "m(M9)(#11)", L"-∆9(#11)", Minor),
-		ChordPattern("101100111001", "m(M9)(#11,b13)", L"-∆9(#11,b13)", Minor),
-		ChordPattern("101100001001", "m(M9)(#5)", L"-∆9(#5)", Minor),
-		ChordPattern("101100001101", "m(M9)(#5,13)", L"-∆9(#5,13)", Minor),
-		ChordPattern("101100010101", "m(M9)(13)", L"-∆9(13)", Minor),
-		ChordPattern("101100111101", "m(M9)(6,#11,b13)", L"-∆9(6,#11,b13)", Minor),
-		ChordPattern("101100011101", "m(M9)(6,b13)", L"-∆9(6,b13)", Minor),
-		ChordPattern("101100011001", "m(M9)(b13)", L"-∆9(b13)", Minor),
-		ChordPattern("101101010010", "m11", L"-11", Minor),
-		ChordPattern("101101001010", "m11(#5)", L"-11(#5)", Minor),
-		ChordPattern("110101001010", "m11(#5,b9)", L"-11(#5,b9)", Minor),
-		ChordPattern("101101011110", "m11(6,b13)", L"-11(6,b13)", Minor),
-		ChordPattern("101101011010", "m11(b13)", L"-11(b13)", Minor),
-		ChordPattern("110101011010", "m11(b9,b13)", L"-11(b9,b13)", Minor),
-		ChordPattern("101101010110", "m13", L"-13", Minor),
-		ChordPattern("101100110110", "m13(#11)", L"-13(#11)", Minor),
-		ChordPattern("101101001110", "m13(#5)", L"-13(#5)", Minor),
-		ChordPattern("101100101110", "m13(#5,#11)", L"-13(#5,#11)", Minor),
-		ChordPattern("110101001110", "m13(#5,b9)", L"-13(#5,b9)", Minor),
-		ChordPattern("110100101110", "m13(#5,b9,#11)", L"-13(#5,b9,#11)", Minor),
-		ChordPattern("110101010110", "m13(b9)", L"-13(b9)", Minor),
-		ChordPattern("110100110110", "m13(b9,#11)", L"-13(b9,#11)", Minor),
-		ChordPattern("100100010100", "m6", L"-6", Minor),
-		ChordPattern("100100111100", "m6(#11,b13)", L"-6(#11,b13)", Minor),
-		ChordPattern("110100001100", "m6(#5,b9)", L"-6(#5,b9)", Minor),
-		ChordPattern("101101011100", "m6(9,11,b13)", L"-6(9,11,b13)", Minor),
-		ChordPattern("101100011100", "m6(9,b13)", L"-6(9,b13)", Minor),
-		ChordPattern("100100011100", "m6(b13)", L"-6(b13)", Minor),
-		ChordPattern("110101011100", "m6(b9,11,b13)", L"-6(b9,11,b13)", Minor),
-		ChordPattern("110100011100", "m6(b9,b13)", L"-6(b9,b13)", Minor),
-		ChordPattern("100100010010", "m7", L"-7", Minor),
-		ChordPattern("100100110010", "m7(#11)", L"-7(#11)", Minor),
-		ChordPattern("100100110110", "m7(#11,13)", L"-7(#11,13)", Minor),
-		ChordPattern("100100111010", "m7(#11,b13)", L"-7(#11,b13)", Minor),
-		ChordPattern("100100001010", "m7(#5)", L"-7(#5)", Minor),
-		ChordPattern("100100101110", "m7(#5,#11,13)", L"-7(#5,#11,13)", Minor),
-		ChordPattern("100101001010", "m7(#5,11)", L"-7(#5,11)", Minor),
-		ChordPattern("100101001110", "m7(#5,11,13)", L"-7(#5,11,13)", Minor),
-		ChordPattern("100100001110", "m7(#5,13)", L"-7(#5,13)", Minor),
-		ChordPattern("110100001010", "m7(#5,b9)", L"-7(#5,b9)", Minor),
-		ChordPattern("110100001110", "m7(#5,b9,13)", L"-7(#5,b9,13)", Minor),
-		ChordPattern("100101010010", "m7(11)", L"-7(11)", Minor),
-		ChordPattern("100101010110", "m7(11,13)", L"-7(11,13)", Minor),
-		ChordPattern("100101011010", "m7(11,b13)", L"-7(11,b13)", Minor),
-		ChordPattern("100100010110", "m7(13)", L"-7(13)", Minor),
-		ChordPattern("100100111110", "m7(6,#11,b13)", L"-7(6,#11,b13)", Minor),
-		ChordPattern("100101011110", "m7(6,11,b13)", L"-7(6,11,b13)", Minor),
-		ChordPattern("100100011110", "m7(6,b13)", L"-7(6,b13)", Minor),
-		ChordPattern("110100111110", "m7(6,b9,#11,b13)", L"-7(6,b9,#11,b13)", Minor),
-		ChordPattern("100100011010", "m7(b13)", L"-7(b13)", Minor),
-		ChordPattern("110100010010", "m7(b9)", L"-7(b9)", Minor),
-		ChordPattern("110100110010", "m7(b9,#11)", L"-7(b9,#11)", Minor),
-		ChordPattern("110100111010", "m7(b9,#11,b13)", L"-7(b9,#11,b13)", Minor),
-		ChordPattern("110101010010", "m7(b9,11)", L"-7(b9,11)", Minor),
-		ChordPattern("110100010110", "m7(b9,13)", L"-7(b9,13)", Minor),
-		ChordPattern("110100011010", "m7(b9,b13)", L"-7(b9,b13)", Minor),
-		ChordPattern("101100010010", "m9", L"-9", Minor),
-		ChordPattern("101100110010", "m9(#11)", L"-9(#11)", Minor),
-		ChordPattern("101100111010", "m9(#11,b13)", L"-9(#11,b13)", Minor),
-		ChordPattern("101100001010", "m9(#5)", L"-9(#5)", Minor),
-		ChordPattern("101100001110", "m9(#5,13)", L"-9(#5,13)", Minor),
-		ChordPattern("101100010110", "m9(13)", L"-9(13)", Minor),
-		ChordPattern("101100111100", "m9(6,#11,b13)", L"-9(6,#11,b13)", Minor),
-		ChordPattern("101100011110", "m9(6,b13)", L"-9(6,b13)", Minor),
-		ChordPattern("101100011010", "m9(b13)", L"-9(b13)", Minor),
-		//augmented
-		ChordPattern("100010001000", "aug", L"+", Aug),
-		ChordPattern("100010101100", "aug(#11,13)", L"+(#11,13)", Aug),
-		ChordPattern("100110101000", "aug(#9,#11)", L"+(#9,#11)", Aug),
-		ChordPattern("100110101100", "aug(#9,#11,13)", L"+(#9,#11,13)", Aug),
-		ChordPattern("100111001000", "aug(#9,11)", L"+(#9,11)", Aug),
-		ChordPattern("100111001100", "aug(#9,11,13)", L"+(#9,11,13)", Aug),
-		ChordPattern("100110001100", "aug(#9,13)", L"+(#9,13)", Aug),
-		ChordPattern("100011001100", "aug(11,13)", L"+(11,13)", Aug),
-		ChordPattern("101010101000", "aug(9,#11)", L"+(9,#11)", Aug),
-		ChordPattern("101010101100", "aug(9,#11,13)", L"+(9,#11,13)", Aug),
-		ChordPattern("101011001000", "aug(9,11)", L"+(9,11)", Aug),
-		ChordPattern("101011001100", "aug(9,11,13)", L"+(9,11,13)", Aug),
-		ChordPattern("101010001100", "aug(9,13)", L"+(9,13)", Aug),
-		ChordPattern("100010101000", "aug(add#11)", L"+(add#11)", Aug),
-		ChordPattern("100110001000", "aug(add#9)", L"+(add#9)", Aug),
-		ChordPattern("100011001000", "aug(add11)", L"+(add11)", Aug),
-		ChordPattern("101010001000", "aug(add9)", L"+(add9)", Aug),
-		ChordPattern("110010001000", "aug(addb9)", L"+(addb9)", Aug),
-		ChordPattern("110010101000", "aug(b9,#11)", L"+(b9,#11)", Aug),
-		ChordPattern("110010101100", "aug(b9,#11,13)", L"+(b9,#11,13)", Aug),
-		ChordPattern("110110001000", "aug(b9,#9)", L"+(b9,#9)", Aug),
-		ChordPattern("110110101000", "aug(b9,#9,#11)", L"+(b9,#9,#11)", Aug),
-		ChordPattern("110110101010", "aug(b9,#9,#11,13)", L"+(b9,#9,#11,13)", Aug),
-		ChordPattern("110110101100", "aug(b9,#9,#11,b13)", L"+alt", Aug),
-		ChordPattern("110111001000", "aug(b9,#9,11)", L"+(b9,#9,11)", Aug),
-		ChordPattern("110111001010", "aug(b9,#9,11,13)", L"+(b9,#9,11,13)", Aug),
-		ChordPattern("110111001100", "aug(b9,#9,11,b13)", L"+(b9,#9,11,b13)", Aug),
-		ChordPattern("110011001000", "aug(b9,11)", L"+(b9,11)", Aug),
-		ChordPattern("110011001100", "aug(b9,11,13)", L"+(b9,11,13)", Aug),
-		ChordPattern("110010001100", "aug(b9,13)", L"+(b9,13)", Aug),
-		ChordPattern("101011001001", "aug(M11)", L"+∆11", Aug),
-		ChordPattern("100111001001", "aug(M11)(#9)", L"+∆11(#9)", Aug),
-		ChordPattern("110011001001", "aug(M11)(b9)", L"+∆11(b9)", Aug),
-		ChordPattern("101011001101", "aug(M13)", L"+∆13", Aug),
-		ChordPattern("101010101101", "aug(M13)(#11)", L"+∆13(#11)", Aug),
-		ChordPattern("100111001101", "aug(M13)(#9)", L"+∆13(#9)", Aug),
-		ChordPattern("100110101101", "aug(M13)(#9,#11)", L"+∆13(#9,#11)", Aug),
-		ChordPattern("110011001101", "aug(M13)(b9)", L"+∆13(b9)", Aug),
-		ChordPattern("110010101101", "aug(M13)(b9,#11)", L"+∆13(b9,#11)", Aug),
-		ChordPattern("100010001001", "aug(M7)", L"+∆", Aug),
-		ChordPattern("100010101001", "aug(M7)(#11)", L"+∆(#11)", Aug),
-		ChordPattern("100010101101", "aug(M7)(#11,13)", L"+∆(#11,13)", Aug),
-		ChordPattern("100110001001", "aug(M7)(#9)", L"+∆(#9)", Aug),
-		ChordPattern("100110101001", "aug(M7)(#9,#11)", L"+∆(#9,#11)", Aug),
-		ChordPattern("100110001101", "aug(M7)(#9,13)", L"+∆(#9,13)", Aug),
-		ChordPattern("100011001001", "aug(M7)(11)", L"+∆(11)", Aug),
-		ChordPattern("100011001101", "aug(M7)(11,13)", L"+∆(11,13)", Aug),
-		ChordPattern("100010001101", "aug(M7)(13)", L"+∆(13)", Aug),
-		ChordPattern("110010001001", "aug(M7)(b9)", L"+∆(b9)", Aug),
-		ChordPattern("110010101001", "aug(M7)(b9,#11)", L"+∆(b9,#11)", Aug),
-		ChordPattern("110110001001", "aug(M7)(b9,#9)", L"+∆(b9,#9)", Aug),
-		ChordPattern("110110101001", "aug(M7)(b9,#9,#11)", L"+∆(b9,#9,#11)", Aug),
-		ChordPattern("110110101101", "aug(M7)(b9,#9,#11,13)", L"+∆(b9,#9,#11,13)", Aug),
-		ChordPattern("110111001001", "aug(M7)(b9,#9,11)", L"+∆(b9,#9,11)", Aug),
-		ChordPattern("110111001101", "aug(M7)(b9,#9,11,13)", L"+∆(b9,#9,11,13)", Aug),
-		ChordPattern("110010001101", "aug(M7)(b9,13)", L"+∆(b9,13)", Aug),
-		ChordPattern("101010001001", "aug(M9)", L"+∆9", Aug),
-		ChordPattern("101010101001", "aug(M9)(#11)", L"+∆9(#11)", Aug),
-		ChordPattern("101010001101", "aug(M9)(13)", L"+∆9(13)", Aug),
-		ChordPattern("101011001010", "aug11", L"+11", Aug),
-		ChordPattern("100111001010", "aug11(#9)", L"+11(#9)", Aug),
-		ChordPattern("110011001010", "aug11(b9)", L"+11(b9)", Aug),
-		ChordPattern("101011001110", "aug13", L"+13", Aug),
-		ChordPattern("101010101110", "aug13(#11)", L"+13(#11)", Aug),
-		ChordPattern("100111001110", "aug13(#9)", L"+13(#9)", Aug),
-		ChordPattern("100110101110", "aug13(#9,#11)", L"+13(#9,#11)", Aug),
-		ChordPattern("110011001110", "aug13(b9)", L"+13(b9)", Aug),
-		ChordPattern("110010101110", "aug13(b9,#11)", L"+13(b9,#11)", Aug),
-		ChordPattern("100010001100", "aug6", L"+6", Aug),
-		ChordPattern("100010001010", "aug7", L"+7", Aug),
-		ChordPattern("100010101010", "aug7(#11)", L"+7(#11)", Aug),
-		ChordPattern("100010101110", "aug7(#11,13)", L"+7(#11,13)", Aug),
-		ChordPattern("100110001010", "aug7(#9)", L"+7(#9)", Aug),
-		ChordPattern("100110101010", "aug7(#9,#11)", L"+7(#9,#11)", Aug),
-		ChordPattern("100110001110", "aug7(#9,13)", L"+7(#9,13)", Aug),
-		ChordPattern("100011001010", "aug7(11)", L"+7(11)", Aug),
-		ChordPattern("100011001110", "aug7(11,13)", L"+7(11,13)", Aug),
-		ChordPattern("100010001110", "aug7(13)", L"+7(13)", Aug),
-		ChordPattern("110010001010", "aug7(b9)", L"+7(b9)", Aug),
-		ChordPattern("110010101010", "aug7(b9,#11)", L"+7(b9,#11)", Aug),
-		ChordPattern("110110001010", "aug7(b9,#9)", L"+7(b9,#9)", Aug),
-		ChordPattern("110110101110", "aug7(b9,#9,#11,13)", L"+7(b9,#9,#11,13)", Aug),
-		ChordPattern("110111001110", "aug7(b9,#9,11,13)", L"+7(b9,#9,11,13)", Aug),
-		ChordPattern("110010001110", "aug7(b9,13)", L"+7(b9,13)", Aug),
-		ChordPattern("101010001010", "aug9", L"+9", Aug),
-		ChordPattern("101010101010", "aug9(#11)", L"+9(#11)", Aug),
-		ChordPattern("101010001110", "aug9(13)", L"+9(13)", Aug),
-		//diminished
-		ChordPattern("100100100000", "dim", L"°", Dim),
-		ChordPattern("100101101000", "dim(11,b13)", L"°(11,b13)", Dim),
-		ChordPattern("101101100000", "dim(9,11)", L"°(9,11)", Dim),
-		ChordPattern("101101101000", "dim(9,11,b13)", L"°(9,11,b13)", Dim),
-		ChordPattern("101100101000", "dim(9,b13)", L"°(9,b13)", Dim),
-		ChordPattern("100101100000", "dim(add11)", L"°(add11)", Dim),
-		ChordPattern("101100100000", "dim(add9)", L"°(add9)", Dim),
-		ChordPattern("100100101000", "dim(addb13)", L"°(addb13)", Dim),
-		ChordPattern("110100100000", "dim(addb9)", L"°(addb9)", Dim),
-		ChordPattern("110101100000", "dim(b9,11)", L"°(b9,11)", Dim),
-		ChordPattern("110101101000", "dim(b9,11,b13)", L"°(b9,11,b13)", Dim),
-		ChordPattern("110100101000", "dim(b9,b13)", L"°(b9,b13)", Dim),
-		ChordPattern("101101100001", "dim(M11)", L"°∆11", Dim),
-		ChordPattern("101101101101", "dim(M11)(6,b13)", L"°∆11(6,b13)", Dim),
-		ChordPattern("101101101001", "dim(M11)(b13)", L"°∆11(b13)", Dim),
-		ChordPattern("110101101001", "dim(M11)(b9,b13)", L"°∆11(b9,b13)", Dim),
-		ChordPattern("101101100101", "dim(M13)", L"°∆13", Dim),
-		ChordPattern("110101100101", "dim(M13)(b9)", L"°∆13(b9)", Dim),
-		ChordPattern("100100100001", "dim(M7)", L"°∆", Dim),
-		ChordPattern("100101100001", "dim(M7)(11)", L"°∆(11)", Dim),
-		ChordPattern("100101100101", "dim(M7)(11,13)", L"°∆(11,13)", Dim),
-		ChordPattern("100101101001", "dim(M7)(11,b13)", L"°∆(11,b13)", Dim),
-		ChordPattern("100100100101", "dim(M7)(13)", L"°∆(13)", Dim),
-		ChordPattern("100101101101", "dim(M7)(6,11,b13)", L"°∆(6,11,b13)", Dim),
-		ChordPattern("100100101101", "dim(M7)(6,b13)", L"°∆(6,b13)", Dim),
-		ChordPattern("110100101101", "dim(M7)(6,b9,b13)", L"°∆(6,b9,b13)", Dim),
-		ChordPattern("100100101001", "dim(M7)(b13)", L"°∆(b13)", Dim),
-		ChordPattern("110100100001", "dim(M7)(b9)", L"°∆(b9)", Dim),
-		ChordPattern("110101100001", "dim(M7)(b9,11)", L"°∆(b9,11)", Dim),
-		ChordPattern("110100100101", "dim(M7)(b9,13)", L"°∆(b9,13)", Dim),
-		ChordPattern("110100101001", "dim(M7)(b9,b13)", L"°∆(b9,b13)", Dim),
-		ChordPattern("101100100001", "dim(M9)", L"°∆9", Dim),
-		ChordPattern("101100100101", "dim(M9)(13)", L"°∆9(13)", Dim),
-		ChordPattern("101100101101", "dim(M9)(6,b13)", L"°∆9(6,b13)", Dim),
-		ChordPattern("101100101001", "dim(M9)(b13)", L"°∆9(b13)", Dim),
-		ChordPattern("101101100100", "dim11", L"°11", Dim),
-		ChordPattern("101101101100", "dim11(b13)", L"°11(b13)", Dim),
-		ChordPattern("110101101100", "dim11(b9,b13)", L"°11(b9,b13)", Dim),
-		ChordPattern("100100100100", "dim7", L"°7", Dim),
-		ChordPattern("100101100100", "dim7(11)", L"°7(11)", Dim),
-		ChordPattern("100101101100", "dim7(11,b13)", L"°7(11,b13)", Dim),
-		ChordPattern("100100101100", "dim7(b13)", L"°7(b13)", Dim),
-		ChordPattern("110100100100", "dim7(b9)", L"°7(b9)", Dim),
-		ChordPattern("110101100100", "dim7(b9,11)", L"°7(b9,11)", Dim),
-		ChordPattern("110100101100", "dim7(b9,b13)", L"°7(b9,b13)", Dim),
-		ChordPattern("101100100100", "dim9", L"°9", Dim),
-		ChordPattern("101100101100", "dim9(b13)", L"°9(b13)", Dim),
-		ChordPattern("101101101110", "m11(b5,6,b13)", L"ø11(6,b13)", Dim),
-		ChordPattern("100100100010", "m7(b5)", L"ø", Dim),
-		ChordPattern("100101100010", "m7(b5,11)", L"ø(11)", Dim),
-		ChordPattern("100101100110", "m7(b5,11,13)", L"ø(11,13)", Dim),
-		ChordPattern("100101101010", "m7(b5,11,b13)", L"ø(11,b13)", Dim),
-		ChordPattern("100100100110", "m7(b5,13)", L"ø(13)", Dim),
-		ChordPattern("100101101110", "m7(b5,6,11,b13)", L"ø(6,11,b13)", Dim),
-		ChordPattern("110101101110", "m7(b5,6,b9,11,b13)", L"ø(6,b9,11,b13)", Dim),
-		ChordPattern("100100101010", "m7(b5,b13)", L"ø(b13)", Dim),
-		ChordPattern("110100100010", "m7(b5,b9)", L"ø(b9)", Dim),
-		ChordPattern("110101100010", "m7(b5,b9,11)", L"ø(b9,11)", Dim),
-		ChordPattern("110101100110", "m7(b5,b9,11,13)", L"ø(b9,11,13)", Dim),
-		ChordPattern("110101101010", "m7(b5,b9,11,b13)", L"ø(b9,11,b13)", Dim),
-		ChordPattern("110100100110", "m7(b5,b9,13)", L"ø(b9,13)", Dim),
-		ChordPattern("110100101010", "m7(b5,b9,b13)", L"ø(b9,b13)", Dim),
-		ChordPattern("101100100010", "m9(b5)", L"ø9", Dim),
-		ChordPattern("101101100010", "m9(b5,11)", L"ø9(11)", Dim),
-		ChordPattern("101101100110", "m9(b5,11,13)", L"ø9(11,13)", Dim),
-		ChordPattern("101101101010", "m9(b5,11,b13)", L"ø9(11,b13)", Dim),
-		ChordPattern("101100100110", "m9(b5,13)", L"ø9(13)", Dim),
-		ChordPattern("101100101010", "m9(b5,b13)", L"ø9(b13)", Dim),
-		//suspended 2nd
-		ChordPattern("101000010000", "sus2", L"sus2", Sus),
-		ChordPattern("101000111100", "6sus2(#11,b13)", L"6sus2(#11,b13)", Sus),
-		ChordPattern("101001011100", "6sus2(11,b13)", L"6sus2(11,b13)", Sus),
-		ChordPattern("101000011100", "6sus2(b13)", L"6sus2(b13)", Sus),
-		ChordPattern("101001101100", "6sus2(b5,11,b13)", L"6sus2(b5,11,b13)", Sus),
-		ChordPattern("101000101100", "6sus2(b5,b13)", L"6sus2(b5,b13)", Sus),
-		ChordPattern("111001101100", "6sus2(b5,b9,11,b13)", L"6sus2(b5,b9,11,b13)", Sus),
-		ChordPattern("111000101100", "6sus2(b5,b9,b13)", L"6sus2(b5,b9,b13)", Sus),
-		ChordPattern("111001011100", "6sus2(b9,11,b13)", L"6sus2(b9,11,b13)", Sus),
-		ChordPattern("111000011100", "6sus2(b9,b13)", L"6sus2(b9,b13)", Sus),
-		ChordPattern("101000010010", "7sus2", L"7sus2", Sus),
-		ChordPattern("101000110010", "7sus2(#11)", L"7sus2(#11)", Sus),
-		ChordPattern("101000110110", "7sus2(#11,13)", L"7sus2(#11,13)", Sus),
-		ChordPattern("101000111010", "7sus2(#11,b13)", L"7sus2(#11,b13)", Sus),
-		ChordPattern("101000010110", "7sus2(13)", L"7sus2(13)", Sus),
-		ChordPattern("101000111110", "7sus2(6,#11,b13)", L"7sus2(6,#11,b13)", Sus),
-		ChordPattern("101100111110", "7sus2(6,#9,#11,b13)", L"7sus2(6,#9,#11,b13)", Sus),
-		ChordPattern("101000011110", "7sus2(6,b13)", L"7sus2(6,b13)", Sus),
-		ChordPattern("111000111110", "7sus2(6,b9,#11,b13)", L"7sus2(6,b9,#11,b13)", Sus),
-		ChordPattern("101000011010", "7sus2(b13)", L"7sus2(b13)", Sus),
-		ChordPattern("101000100010", "7sus2(b5)", L"7sus2(b5)", Sus),
-		ChordPattern("101000100110", "7sus2(b5,13)", L"7sus2(b5,13)", Sus),
-		ChordPattern("101000101110", "7sus2(b5,6,b13)", L"7sus2(b5,6,b13)", Sus),
-		ChordPattern("111000101110", "7sus2(b5,6,b9,b13)", L"7sus2(b5,6,b9,b13)", Sus),
-		ChordPattern("101000101010", "7sus2(b5,b13)", L"7sus2(b5,b13)", Sus),
-		ChordPattern("111000100010", "7sus2(b5,b9)", L"7sus2(b5,b9)", Sus),
-		ChordPattern("111001101010", "7sus2(b5,b9,11,b13)", L"7sus2(b5,b9,11,b13)", Sus),
-		ChordPattern("111000100110", "7sus2(b5,b9,13)", L"7sus2(b5,b9,13)", Sus),
-		ChordPattern("111000101010", "7sus2(b5,b9,b13)", L"7sus2(b5,b9,b13)", Sus),
-		ChordPattern("111000010010", "7sus2(b9)", L"7sus2(b9)", Sus),
-		ChordPattern("111000110010", "7sus2(b9,#11)", L"7sus2(b9,#11)", Sus),
-		ChordPattern("111000111010", "7sus2(b9,#11,b13)", L"7sus2(b9,#11,b13)", Sus),
-		ChordPattern("111100010010", "7sus2(b9,#9)", L"7sus2(b9,#9)", Sus),
-		ChordPattern("111100110010", "7sus2(b9,#9,#11)", L"7sus2(b9,#9,#11)", Sus),
-		ChordPattern("111100110110", "7sus2(b9,#9,#11,13)", L"7sus2(b9,#9,#11,13)", Sus),
-		ChordPattern("111100111010", "7sus2(b9,#9,#11,b13)", L"7sus2alt", Sus),
-		ChordPattern("111101010010", "7sus2(b9,#9,11)", L"7sus2(b9,#9,11)", Sus),
-		ChordPattern("111101010110", "7sus2(b9,#9,11,13)", L"7sus2(b9,#9,11,13)", Sus),
-		ChordPattern("111101011010", "7sus2(b9,#9,11,b13)", L"7sus2(b9,#9,11,b13)", Sus),
-		ChordPattern("111001010010", "7sus2(b9,11)", L"7sus2(b9,11)", Sus),
-		ChordPattern("111001011010", "7sus2(b9,11,b13)", L"7sus2(b9,11,b13)", Sus),
-		ChordPattern("111000010110", "7sus2(b9,13)", L"7sus2(b9,13)", Sus),
-		ChordPattern("111000011010", "7sus2(b9,b13)", L"7sus2(b9,b13)", Sus),
-		ChordPattern("111001011001", "M11sus2(b9,b13)", L"∆11sus2(b9,b13)", Sus),
-		ChordPattern("111001010101", "M13sus2(b9)", L"∆13sus2(b9)", Sus),
-		ChordPattern("101000010001", "M7sus2", L"∆sus2", Sus),
-		ChordPattern("101000110001", "M7sus2(#11)", L"∆sus2(#11)", Sus),
-		ChordPattern("101000110101", "M7sus2(#11,13)", L"∆sus2(#11,13)", Sus),
-		ChordPattern("101000111001", "M7sus2(#11,b13)", L"∆sus2(#11,b13)", Sus),
-		ChordPattern("101001010001", "M7sus2(11)", L"∆sus2(11)", Sus),
-		ChordPattern("101001010101", "M7sus2(11,13)", L"∆sus2(11,13)", Sus),
-		ChordPattern("101001011001", "M7sus2(11,b13)", L"∆sus2(11,b13)", Sus),
-		ChordPattern("101000010101", "M7sus2(13)", L"∆sus2(13)", Sus),
-		ChordPattern("101000111101", "M7sus2(6,#11,b13)", L"∆sus2(6,#11,b13)", Sus),
-		ChordPattern("101001011101", "M7sus2(6,11,b13)", L"∆sus2(6,11,b13)", Sus),
-		ChordPattern("101000011101", "M7sus2(6,b13)", L"∆sus2(6,b13)", Sus),
-		ChordPattern("111000111101", "M7sus2(6,b9,#11,b13)", L"∆sus2(6,b9,#11,b13)", Sus),
-		ChordPattern("111000011101", "M7sus2(6,b9,b13)", L"∆sus2(6,b9,b13)", Sus),
-		ChordPattern("101000011001", "M7sus2(b13)", L"∆sus2(b13)", Sus),
-		ChordPattern("101000100001", "M7sus2(b5)", L"∆sus2(b5)", Sus),
-		ChordPattern("101000100101", "M7sus2(b5,13)", L"∆sus2(b5,13)", Sus),
-		ChordPattern("101000101101", "M7sus2(b5,6,b13)", L"∆sus2(b5,6,b13)", Sus),
-		ChordPattern("111000101101", "M7sus2(b5,6,b9,b13)", L"∆sus2(b5,6,b9,b13)", Sus),
-		ChordPattern("101000101001", "M7sus2(b5,b13)", L"∆sus2(b5,b13)", Sus),
-		ChordPattern("111000100001", "M7sus2(b5,b9)", L"∆sus2(b5,b9)", Sus),
-		ChordPattern("111000100101", "M7sus2(b5,b9,13)", L"∆sus2(b5,b9,13)", Sus),
-		ChordPattern("111000101001", "M7sus2(b5,b9,b13)", L"∆sus2(b5,b9,b13)", Sus),
-		ChordPattern("111000010001", "M7sus2(b9)", L"∆sus2(b9)", Sus),
-		ChordPattern("111000110001", "M7sus2(b9,#11)", L"∆sus2(b9,#11)", Sus),
-		ChordPattern("111000111001", "M7sus2(b9,#11,b13)", L"∆sus2(b9,#11,b13)", Sus),
-		ChordPattern("111100010001", "M7sus2(b9,#9)", L"∆sus2(b9,#9)", Sus),
-		ChordPattern("111100110001", "M7sus2(b9,#9,#11)", L"∆sus2(b9,#9,#11)", Sus),
-		ChordPattern("111100110101", "M7sus2(b9,#9,#11,13)", L"∆sus2(b9,#9,#11,13)", Sus),
-		ChordPattern("111100111001", "M7sus2(b9,#9,#11,b13)", L"∆sus2alt", Sus),
-		ChordPattern("111101010001", "M7sus2(b9,#9,11)", L"∆sus2(b9,#9,11)", Sus),
-		ChordPattern("111101010101", "M7sus2(b9,#9,11,13)", L"∆sus2(b9,#9,11,13)", Sus),
-		ChordPattern("111101011001", "M7sus2(b9,#9,11,b13)", L"∆sus2(b9,#9,11,b13)", Sus),
-		ChordPattern("111001010001", "M7sus2(b9,11)", L"∆sus2(b9,11)", Sus),
-		ChordPattern("111000010101", "M7sus2(b9,13)", L"∆sus2(b9,13)", Sus),
-		ChordPattern("111000011001", "M7sus2(b9,b13)", L"∆sus2(b9,b13)", Sus),
-		ChordPattern("101000110000", "sus2(#11)", L"sus2(#11)", Sus),
-		ChordPattern("101000110100", "sus2(#11,13)", L"sus2(#11,13)", Sus),
-		ChordPattern("101000111000", "sus2(#11,b13)", L"sus2(#11,b13)", Sus),
-		ChordPattern("101000010100", "sus2(13)", L"sus2(13)", Sus),
-		ChordPattern("101000011000", "sus2(b13)", L"sus2(b13)", Sus),
-		ChordPattern("101000100000", "sus2(b5)", L"sus2(b5)", Sus),
-		ChordPattern("101000100100", "sus2(b5,13)", L"sus2(b5,13)", Sus),
-		ChordPattern("101000101000", "sus2(b5,b13)", L"sus2(b5,b13)", Sus),
-		ChordPattern("111000100000", "sus2(b5,b9)", L"sus2(b5,b9)", Sus),
-		ChordPattern("111000100100", "sus2(b5,b9,13)", L"sus2(b5,b9,13)", Sus),
-		ChordPattern("111000101000", "sus2(b5,b9,b13)", L"sus2(b5,b9,b13)", Sus),
-		ChordPattern("111000010000", "sus2(b9)", L"sus2(b9)", Sus),
-		ChordPattern("111000110000", "sus2(b9,#11)", L"sus2(b9,#11)", Sus),
-		ChordPattern("111000110100", "sus2(b9,#11,13)", L"sus2(b9,#11,13)", Sus),
-		ChordPattern("111000111000", "sus2(b9,#11,b13)", L"sus2(b9,#11,b13)", Sus),
-		ChordPattern("111100010000", "sus2(b9,#9)", L"sus2(b9,#9)", Sus),
-		ChordPattern("111100110000", "sus2(b9,#9,#11)", L"sus2(b9,#9,#11)", Sus),
-		ChordPattern("111100110100", "sus2(b9,#9,#11,13)", L"sus2(b9,#9,#11,13)", Sus),
-		ChordPattern("111100111000", "sus2(b9,#9,#11,b13)", L"sus2alt", Sus),
-		ChordPattern("111101010000", "sus2(b9,#9,11)", L"sus2(b9,#9,11)", Sus),
-		ChordPattern("111101010100", "sus2(b9,#9,11,13)", L"sus2(b9,#9,11,13)", Sus),
-		ChordPattern("111101011000", "sus2(b9,#9,11,b13)", L"sus2(b9,#9,11,b13)", Sus),
-		ChordPattern("111001010000", "sus2(b9,11)", L"sus2(b9,11)", Sus),
-		ChordPattern("111001010100", "sus2(b9,11,13)", L"sus2(b9,11,13)", Sus),
-		ChordPattern("111001011000", "sus2(b9,11,b13)", L"sus2(b9,11,b13)", Sus),
-		ChordPattern("111000010100", "sus2(b9,13)", L"sus2(b9,13)", Sus),
-		ChordPattern("111000011000", "sus2(b9,b13)", L"sus2(b9,b13)", Sus),
-		//suspended 4th
-		ChordPattern("100001010000", "sus4", L"sus4", Sus),
-		ChordPattern("100001011100", "6sus4(b13)", L"6sus4(b13)", Sus),
-		ChordPattern("110001011100", "6sus4(b9,b13)", L"6sus4(b9,b13)", Sus),
-		ChordPattern("100001010010", "7sus4", L"7sus4", Sus),
-		ChordPattern("100001110010", "7sus4(#11)", L"7sus4(#11)", Sus),
-		ChordPattern("100001110110", "7sus4(#11,13)", L"7sus4(#11,13)", Sus),
-		ChordPattern("100001111010", "7sus4(#11,b13)", L"7sus4(#11,b13)", Sus),
-		ChordPattern("100101110010", "7sus4(#9,#11)", L"7sus4(#9,#11)", Sus),
-		ChordPattern("100101111010", "7sus4(#9,#11,b13)", L"7sus4(#9,#11,b13)", Sus),
-		ChordPattern("100001010110", "7sus4(13)", L"7sus4(13)", Sus),
-		ChordPattern("100001111110", "7sus4(6,#11,b13)", L"7sus4(6,#11,b13)", Sus),
-		ChordPattern("100101111110", "7sus4(6,#9,#11,b13)", L"7sus4(6,#9,#11,b13)", Sus),
-		ChordPattern("101001011110", "7sus4(6,9,b13)", L"7sus4(6,9,b13)", Sus),
-		ChordPattern("100001011110", "7sus4(6,b13)", L"7sus4(6,b13)", Sus),
-		ChordPattern("110001111110", "7sus4(6,b9,#11,b13)", L"7sus4(6,b9,#11,b13)", Sus),
-		ChordPattern("100001011010", "7sus4(b13)", L"7sus4(b13)", Sus),
-		ChordPattern("110001010010", "7sus4(b9)", L"7sus4(b9)", Sus),
-		ChordPattern("110001110010", "7sus4(b9,#11)", L"7sus4(b9,#11)", Sus),
-		ChordPattern("110001111010", "7sus4(b9,#11,b13)", L"7sus4(b9,#11,b13)", Sus),
-		ChordPattern("110101110010", "7sus4(b9,#9,#11)", L"7sus4(b9,#9,#11)", Sus),
-		ChordPattern("110101110110", "7sus4(b9,#9,#11,13)", L"7sus4(b9,#9,#11,13)", Sus),
-		ChordPattern("110101111010", "7sus4(b9,#9,#11,b13)", L"7sus4alt", Sus),
-		ChordPattern("110001010110", "7sus4(b9,13)", L"7sus4(b9,13)", Sus),
-		ChordPattern("110001011010", "7sus4(b9,b13)", L"7sus4(b9,b13)", Sus),
-		ChordPattern("101001010010", "9sus4", L"9sus4", Sus),
-		ChordPattern("101001110010", "9sus4(#11)", L"9sus4(#11)", Sus),
-		ChordPattern("101001111010", "9sus4(#11,b13)", L"9sus4(#11,b13)", Sus),
-		ChordPattern("101001010110", "9sus4(13)", L"9sus4(13)", Sus),
-		ChordPattern("101001111110", "9sus4(6,#11,b13)", L"9sus4(6,#11,b13)", Sus),
-		ChordPattern("101001011010", "9sus4(b13)", L"9sus4(b13)", Sus),
-		ChordPattern("100001010001", "M7sus4", L"∆sus4", Sus),
-		ChordPattern("100001110001", "M7sus4(#11)", L"∆sus4(#11)", Sus),
-		ChordPattern("100001110101", "M7sus4(#11,13)", L"∆sus4(#11,13)", Sus),
-		ChordPattern("100001111001", "M7sus4(#11,b13)", L"∆sus4(#11,b13)", Sus),
-		ChordPattern("100101110001", "M7sus4(#9,#11)", L"∆sus4(#9,#11)", Sus),
-		ChordPattern("100101111001", "M7sus4(#9,#11,b13)", L"∆sus4(#9,#11,b13)", Sus),
-		ChordPattern("100001010101", "M7sus4(13)", L"∆sus4(13)", Sus),
-		ChordPattern("100001111101", "M7sus4(6,#11,b13)", L"∆sus4(6,#11,b13)", Sus),
-		ChordPattern("100101111101", "M7sus4(6,#9,#11,b13)", L"∆sus4(6,#9,#11,b13)", Sus),
-		ChordPattern("100001011101", "M7sus4(6,b13)", L"∆sus4(6,b13)", Sus),
-		ChordPattern("110001111101", "M7sus4(6,b9,#11,b13)", L"∆sus4(6,b9,#11,b13)", Sus),
-		ChordPattern("110001011101", "M7sus4(6,b9,b13)", L"∆sus4(6,b9,b13)", Sus),
-		ChordPattern("100001011001", "M7sus4(b13)", L"∆sus4(b13)", Sus),
-		ChordPattern("110001010001", "M7sus4(b9)", L"∆sus4(b9)", Sus),
-		ChordPattern("110001110001", "M7sus4(b9,#11)", L"∆sus4(b9,#11)", Sus),
-		ChordPattern("110001111001", "M7sus4(b9,#11,b13)", L"∆sus4(b9,#11,b13)", Sus),
-		ChordPattern("110101110001", "M7sus4(b9,#9,#11)", L"∆sus4(b9,#9,#11)", Sus),
-		ChordPattern("110101110101", "M7sus4(b9,#9,#11,13)", L"∆sus4(b9,#9,#11,13)", Sus),
-		ChordPattern("110101111001", "M7sus4(b9,#9,#11,b13)", L"∆sus4alt", Sus),
-		ChordPattern("110001010101", "M7sus4(b9,13)", L"∆sus4(b9,13)", Sus),
-		ChordPattern("110001011001", "M7sus4(b9,b13)", L"∆sus4(b9,b13)", Sus),
-		ChordPattern("101001110001", "M9sus4(#11)", L"∆9sus4(#11)", Sus),
-		ChordPattern("101001111001", "M9sus4(#11,b13)", L"∆9sus4(#11,b13)", Sus),
-		ChordPattern("100001110000", "sus4(#11)", L"sus4(#11)", Sus),
-		ChordPattern("100001110100", "sus4(#11,13)", L"sus4(#11,13)", Sus),
-		ChordPattern("100001111000", "sus4(#11,b13)", L"sus4(#11,b13)", Sus),
-		ChordPattern("100101110000", "sus4(#9,#11)", L"sus4(#9,#11)", Sus),
-		ChordPattern("100101110100", "sus4(#9,#11,13)", L"sus4(#9,#11,13)", Sus),
-		ChordPattern("100101111000", "sus4(#9,#11,b13)", L"sus4(#9,#11,b13)", Sus),
-		ChordPattern("100001010100", "sus4(13)", L"sus4(13)", Sus),
-		ChordPattern("101001010000", "sus4(9)", L"sus4(9)", Sus),
-		ChordPattern("101001110000", "sus4(9,#11)", L"sus4(9,#11)", Sus),
-		ChordPattern("101001110100", "sus4(9,#11,13)", L"sus4(9,#11,13)", Sus),
-		ChordPattern("101001111000", "sus4(9,#11,b13)", L"sus4(9,#11,b13)", Sus),
-		ChordPattern("101001010100", "sus4(9,13)", L"sus4(9,13)", Sus),
-		ChordPattern("101001011000", "sus4(9,b13)", L"sus4(9,b13)", Sus),
-		ChordPattern("100001011000", "sus4(b13)", L"sus4(b13)", Sus),
-		ChordPattern("110001010000", "sus4(b9)", L"sus4(b9)", Sus),
-		ChordPattern("110001110000", "sus4(b9,#11)", L"sus4(b9,#11)", Sus),
-		ChordPattern("110001110100", "sus4(b9,#11,13)", L"sus4(b9,#11,13)", Sus),
-		ChordPattern("110001111000", "sus4(b9,#11,b13)", L"sus4(b9,#11,b13)", Sus),
-		ChordPattern("110101110000", "sus4(b9,#9,#11)", L"sus4(b9,#9,#11)", Sus),
-		ChordPattern("110101110100", "sus4(b9,#9,#11,13)", L"sus4(b9,#9,#11,13)", Sus),
-		ChordPattern("110101111000", "sus4(b9,#9,#11,b13)", L"sus4alt", Sus),
-		ChordPattern("110001010100", "sus4(b9,13)", L"sus4(b9,13)", Sus),
-		ChordPattern("110001011000", "sus4(b9,b13)", L"sus4(b9,b13)", Sus),
-		//suspended 2nd and 4th
-		ChordPattern("101001000000", "sus24", L"sus24", Sus),
-		ChordPattern("101001000100", "6sus24", L"6sus24", Sus),
-		ChordPattern("101001001100", "6sus24(b13)", L"6sus24(b13)", Sus),
-		ChordPattern("111001001100", "6sus24(b9,b13)", L"6sus24(b9,b13)", Sus),
-		ChordPattern("101001000010", "7sus24", L"7sus24", Sus),
-		ChordPattern("101001100010", "7sus24(#11)", L"7sus24(#11)", Sus),
-		ChordPattern("101001100110", "7sus24(#11,13)", L"7sus24(#11,13)", Sus),
-		ChordPattern("101001101010", "7sus24(#11,b13)", L"7sus24(#11,b13)", Sus),
-		ChordPattern("101101000010", "7sus24(#9)", L"7sus24(#9)", Sus),
-		ChordPattern("101101000110", "7sus24(#9,13)", L"7sus24(#9,13)", Sus),
-		ChordPattern("101001000110", "7sus24(13)", L"7sus24(13)", Sus),
-		ChordPattern("101001101110", "7sus24(6,#11,b13)", L"7sus24(6,#11,b13)", Sus),
-		ChordPattern("101001001110", "7sus24(6,b13)", L"7sus24(6,b13)", Sus),
-		ChordPattern("111001101110", "7sus24(6,b9,#11,b13)", L"7sus24(6,b9,#11,b13)", Sus),
-		ChordPattern("101001001010", "7sus24(b13)", L"7sus24(b13)", Sus),
-		ChordPattern("111001000010", "7sus24(b9)", L"7sus24(b9)", Sus),
-		ChordPattern("111001100010", "7sus24(b9,#11)", L"7sus24(b9,#11)", Sus),
-		ChordPattern("111101000010", "7sus24(b9,#9)", L"7sus24(b9,#9)", Sus),
-		ChordPattern("111101100010", "7sus24(b9,#9,#11)", L"7sus24(b9,#9,#11)", Sus),
-		ChordPattern("111101100110", "7sus24(b9,#9,#11,13)", L"7sus24(b9,#9,#11,13)", Sus),
-		ChordPattern("111101101010", "7sus24(b9,#9,#11,b13)", L"7sus24alt", Sus),
-		ChordPattern("111101000110", "7sus24(b9,#9,13)", L"7sus24(b9,#9,13)", Sus),
-		ChordPattern("111101001010", "7sus24(b9,#9,b13)", L"7sus24(b9,#9,b13)", Sus),
-		ChordPattern("111001000110", "7sus24(b9,13)", L"7sus24(b9,13)", Sus),
-		ChordPattern("111001001010", "7sus24(b9,b13)", L"7sus24(b9,b13)", Sus),
-		ChordPattern("101001000001", "M7sus24", L"∆sus24", Sus),
-		ChordPattern("101001100001", "M7sus24(#11)", L"∆sus24(#11)", Sus),
-		ChordPattern("101001100101", "M7sus24(#11,13)", L"∆sus24(#11,13)", Sus),
-		ChordPattern("101001101001", "M7sus24(#11,b13)", L"∆sus24(#11,b13)", Sus),
-		ChordPattern("101101000001", "M7sus24(#9)", L"∆sus24(#9)", Sus),
-		ChordPattern("101101000101", "M7sus24(#9,13)", L"∆sus24(#9,13)", Sus),
-		ChordPattern("101001000101", "M7sus24(13)", L"∆sus24(13)", Sus),
-		ChordPattern("101001101101", "M7sus24(6,#11,b13)", L"∆sus24(6,#11,b13)", Sus),
-		ChordPattern("101001001101", "M7sus24(6,b13)", L"∆sus24(6,b13)", Sus),
-		ChordPattern("111001101101", "M7sus24(6,b9,#11,b13)", L"∆sus24(6,b9,#11,b13)", Sus),
-		ChordPattern("111001001101", "M7sus24(6,b9,b13)", L"∆sus24(6,b9,b13)", Sus),
-		ChordPattern("101001001001", "M7sus24(b13)", L"∆sus24(b13)", Sus),
-		ChordPattern("111001000001", "M7sus24(b9)", L"∆sus24(b9)", Sus),
-		ChordPattern("111001100001", "M7sus24(b9,#11)", L"∆sus24(b9,#11)", Sus),
-		ChordPattern("111001101001", "M7sus24(b9,#11,b13)", L"∆sus24(b9,#11,b13)", Sus),
-		ChordPattern("111101000001", "M7sus24(b9,#9)", L"∆sus24(b9,#9)", Sus),
-		ChordPattern("111101100001", "M7sus24(b9,#9,#11)", L"∆sus24(b9,#9,#11)", Sus),
-		ChordPattern("111101100101", "M7sus24(b9,#9,#11,13)", L"∆sus24(b9,#9,#11,13)", Sus),
-		ChordPattern("111101101001", "M7sus24(b9,#9,#11,b13)", L"∆sus24alt", Sus),
-		ChordPattern("111101000101", "M7sus24(b9,#9,13)", L"∆sus24(b9,#9,13)", Sus),
-		ChordPattern("111101001001", "M7sus24(b9,#9,b13)", L"∆sus24(b9,#9,b13)", Sus),
-		ChordPattern("111001000101", "M7sus24(b9,13)", L"∆sus24(b9,13)", Sus),
-		ChordPattern("111001001001", "M7sus24(b9,b13)", L"∆sus24(b9,b13)", Sus),
-		ChordPattern("101001100000", "sus24(#11)", L"sus24(#11)", Sus),
-		ChordPattern("101001100100", "sus24(#11,13)", L"sus24(#11,13)", Sus),
-		ChordPattern("101001101000", "sus24(#11,b13)", L"sus24(#11,b13)", Sus),
-		ChordPattern("101101000000", "sus24(#9)", L"sus24(#9)", Sus),
-		ChordPattern("101101000100", "sus24(#9,13)", L"sus24(#9,13)", Sus),
-		ChordPattern("101001001000", "sus24(b13)", L"sus24(b13)", Sus),
-		ChordPattern("111001000000", "sus24(b9)", L"sus24(b9)", Sus),
-		ChordPattern("111001100000", "sus24(b9,#11)", L"sus24(b9,#11)", Sus),
-		ChordPattern("111001100100", "sus24(b9,#11,13)", L"sus24(b9,#11,13)", Sus),
-		ChordPattern("111001101000", "sus24(b9,#11,b13)", L"sus24(b9,#11,b13)", Sus),
-		ChordPattern("111101000000", "sus24(b9,#9)", L"sus24(b9,#9)", Sus),
-		ChordPattern("111101100000", "sus24(b9,#9,#11)", L"sus24(b9,#9,#11)", Sus),
-		ChordPattern("111101100100", "sus24(b9,#9,#11,13)", L"sus24(b9,#9,#11,13)", Sus),
-		ChordPattern("111101101000", "sus24(b9,#9,#11,b13)", L"sus24alt", Sus),
-		ChordPattern("111101000100", "sus24(b9,#9,13)", L"sus24(b9,#9,13)", Sus),
-		ChordPattern("111101001000", "sus24(b9,#9,b13)", L"sus24(b9,#9,b13)", Sus),
-		ChordPattern("111001000100", "sus24(b9,13)", L"sus24(b9,13)", Sus),
-		ChordPattern("111001001000", "sus24(b9,b13)", L"sus24(b9,b13)", Sus),
-		//major (no5)
-		ChordPattern("100010000000", "(no5)", L"(no5)", Major),
-		ChordPattern("100111000000", "(#9,11)(no5)", L"(#9,11)(no5)", Major),
-		ChordPattern("100111000100", "(#9,11,13)(no5)", L"(#9,11,13)(no5)", Major),
-		ChordPattern("100110000100", "(#9,13)(no5)", L"(#9,13)(no5)", Major),
-		ChordPattern("100011000100", "(11,13)(no5)", L"(11,13)(no5)", Major),
-		ChordPattern("101011000000", "(9,11)(no5)", L"(9,11)(no5)", Major),
-		ChordPattern("101011000100", "(9,11,13)(no5)", L"(9,11,13)(no5)", Major),
-		ChordPattern("101010000100", "(9,13)(no5)", L"(9,13)(no5)", Major),
-		ChordPattern("100110000000", "(add#9)(no5)", L"(add#9)(no5)", Major),
-		ChordPattern("100011000000", "(add11)(no5)", L"(add11)(no5)", Major),
-		ChordPattern("101010000000", "(add9)(no5)", L"(add9)(no5)", Major),
-		ChordPattern("110010000000", "(addb9)(no5)", L"(addb9)(no5)", Major),
-		ChordPattern("110110000000", "(b9,#9)(no5)", L"(b9,#9)(no5)", Major),
-		ChordPattern("110110100000", "(b9,#9,#11)(no5)", L"(b9,#9,#11)(no5)", Major),
-		ChordPattern("110110100100", "(b9,#9,#11,13)(no5)", L"(b9,#9,#11,13)(no5)", Major),
-		ChordPattern("110111000000", "(b9,#9,11)(no5)", L"(b9,#9,11)(no5)", Major),
-		ChordPattern("110111000100", "(b9,#9,11,13)(no5)", L"(b9,#9,11,13)(no5)", Major),
-		ChordPattern("110011000000", "(b9,11)(no5)", L"(b9,11)(no5)", Major),
-		ChordPattern("110011000100", "(b9,11,13)(no5)", L"(b9,11,13)(no5)", Major),
-		ChordPattern("110010000100", "(b9,13)(no5)", L"(b9,13)(no5)", Major),
-		ChordPattern("100111000010", "11(#9)(no5)", L"11(#9)(no5)", Major),
-		ChordPattern("101011000010", "11(no5)", L"11(no5)", Major),
-		ChordPattern("100111000110", "13(#9)(no5)", L"13(#9)(no5)", Major),
-		ChordPattern("110011000110", "13(b9)(no5)", L"13(b9)(no5)", Major),
-		ChordPattern("101011000110", "13(no5)", L"13(no5)", Major),
-		ChordPattern("100010000100", "6(no5)", L"6(no5)", Major),
-		ChordPattern("100110000010", "7(#9)(no5)", L"7(#9)(no5)", Major),
-		ChordPattern("100110000110", "7(#9,13)(no5)", L"7(#9,13)(no5)", Major),
-		ChordPattern("100011000010", "7(11)(no5)", L"7(11)(no5)", Major),
-		ChordPattern("100011000110", "7(11,13)(no5)", L"7(11,13)(no5)", Major),
-		ChordPattern("100010000110", "7(13)(no5)", L"7(13)(no5)", Major),
-		ChordPattern("110010000010", "7(b9)(no5)", L"7(b9)(no5)", Major),
-		ChordPattern("110011000010", "7(b9,11)(no5)", L"7(b9,11)(no5)", Major),
-		ChordPattern("110010000110", "7(b9,13)(no5)", L"7(b9,13)(no5)", Major),
-		ChordPattern("100010000010", "7(no5)", L"7(no5)", Major),
-		ChordPattern("101010000110", "9(13)(no5)", L"9(13)(no5)", Major),
-		ChordPattern("101010000010", "9(no5)", L"9(no5)", Major),
-		ChordPattern("100111000001", "M11(#9)(no5)", L"∆11(#9)(no5)", Major),
-		ChordPattern("101011000001", "M11(no5)", L"∆11(no5)", Major),
-		ChordPattern("100111000101", "M13(#9)(no5)", L"∆13(#9)(no5)", Major),
-		ChordPattern("110011000101", "M13(b9)(no5)", L"∆13(b9)(no5)", Major),
-		ChordPattern("101011000101", "M13(no5)", L"∆13(no5)", Major),
-		ChordPattern("100110000001", "M7(#9)(no5)", L"∆(#9)(no5)", Major),
-		ChordPattern("100110000101", "M7(#9,13)(no5)", L"∆(#9,13)(no5)", Major),
-		ChordPattern("100011000001", "M7(11)(no5)", L"∆(11)(no5)", Major),
-		ChordPattern("100011000101", "M7(11,13)(no5)", L"∆(11,13)(no5)", Major),
-		ChordPattern("100010000101", "M7(13)(no5)", L"∆(13)(no5)", Major),
-		ChordPattern("110010000001", "M7(b9)(no5)", L"∆(b9)(no5)", Major),
-		ChordPattern("110011000001", "M7(b9,11)(no5)", L"∆(b9,11)(no5)", Major),
-		ChordPattern("110010000101", "M7(b9,13)(no5)", L"∆(b9,13)(no5)", Major),
-		ChordPattern("100010000001", "M7(no5)", L"∆(no5)", Major),
-		ChordPattern("101010000101", "M9(13)(no5)", L"∆9(13)(no5)", Major),
-		ChordPattern("101010000001", "M9(no5)", L"∆9(no5)", Major),
-		//minor (no5)
-		ChordPattern("100100000000", "m(no5)", L"-(no5)", Minor),
-		ChordPattern("100101000100", "m(11,13)(no5)", L"-(11,13)(no5)", Minor),
-		ChordPattern("101100000100", "m(9,13)(no5)", L"-(9,13)(no5)", Minor),
-		ChordPattern("100101000000", "m(add11)(no5)", L"-(add11)(no5)", Minor),
-		ChordPattern("101100000000", "m(add9)(no5)", L"-(add9)(no5)", Minor),
-		ChordPattern("110100000000", "m(addb9)(no5)", L"-(addb9)(no5)", Minor),
-		ChordPattern("110101000000", "m(b9,11)(no5)", L"-(b9,11)(no5)", Minor),
-		ChordPattern("110101000100", "m(b9,11,13)(no5)", L"-(b9,11,13)(no5)", Minor),
-		ChordPattern("110100000100", "m(b9,13)(no5)", L"-(b9,13)(no5)", Minor),
-		ChordPattern("110101000101", "m(M13)(b9)(no5)", L"-∆13(b9)(no5)", Minor),
-		ChordPattern("100101000001", "m(M7)(11)(no5)", L"-∆(11)(no5)", Minor),
-		ChordPattern("100101000101", "m(M7)(11,13)(no5)", L"-∆(11,13)(no5)", Minor),
-		ChordPattern("100100000101", "m(M7)(13)(no5)", L"-∆(13)(no5)", Minor),
-		ChordPattern("110100000001", "m(M7)(b9)(no5)", L"-∆(b9)(no5)", Minor),
-		ChordPattern("110101000001", "m(M7)(b9,11)(no5)", L"-∆(b9,11)(no5)", Minor),
-		ChordPattern("110100000101", "m(M7)(b9,13)(no5)", L"-∆(b9,13)(no5)", Minor),
-		ChordPattern("100100000001", "m(M7)(no5)", L"-∆(no5)", Minor),
-		ChordPattern("101100000101", "m(M9)(13)(no5)", L"-∆9(13)(no5)", Minor),
-		ChordPattern("101100000001", "m(M9)(no5)", L"-∆9(no5)", Minor),
-		ChordPattern("110101000110", "m13(b9)(no5)", L"-13(b9)(no5)", Minor),
-		ChordPattern("100100000100", "m6(no5)", L"-6(no5)", Minor),
-		ChordPattern("100101000010", "m7(11)(no5)", L"-7(11)(no5)", Minor),
-		ChordPattern("100101000110", "m7(11,13)(no5)", L"-7(11,13)(no5)", Minor),
-		ChordPattern("100100000110", "m7(13)(no5)", L"-7(13)(no5)", Minor),
-		ChordPattern("110100000010", "m7(b9)(no5)", L"-7(b9)(no5)", Minor),
-		ChordPattern("110101000010", "m7(b9,11)(no5)", L"-7(b9,11)(no5)", Minor),
-		ChordPattern("110100000110", "m7(b9,13)(no5)", L"-7(b9,13)(no5)", Minor),
-		ChordPattern("100100000010", "m7(no5)", L"-7(no5)", Minor),
-		ChordPattern("101100000110", "m9(13)(no5)", L"-9(13)(no5)", Minor),
-		ChordPattern("101100000010", "m9(no5)", L"-9(no5)", Minor),
-		//suspended 2nd (no5)
-		ChordPattern("101000000000", "sus2(no5)", L"sus2(no5)", Sus),
-		ChordPattern("101000001100", "6sus2(b13)(no5)", L"6sus2(b13)(no5)", Sus),
-		ChordPattern("111000001100", "6sus2(b9,b13)(no5)", L"6sus2(b9,b13)(no5)", Sus),
-		ChordPattern("101000000110", "7sus2(13)(no5)", L"7sus2(13)(no5)", Sus),
-		ChordPattern("101000001110", "7sus2(6,b13)(no5)", L"7sus2(6,b13)(no5)", Sus),
-		ChordPattern("101000001010", "7sus2(b13)(no5)", L"7sus2(b13)(no5)", Sus),
-		ChordPattern("111000000010", "7sus2(b9)(no5)", L"7sus2(b9)(no5)", Sus),
-		ChordPattern("111000000110", "7sus2(b9,13)(no5)", L"7sus2(b9,13)(no5)", Sus),
-		ChordPattern("111000001010", "7sus2(b9,b13)(no5)", L"7sus2(b9,b13)(no5)", Sus),
-		ChordPattern("101000000010", "7sus2(no5)", L"7sus2(no5)", Sus),
-		ChordPattern("101000000101", "M7sus2(13)(no5)", L"∆sus2(13)(no5)", Sus),
-		ChordPattern("101000001101", "M7sus2(6,b13)(no5)", L"∆sus2(6,b13)(no5)", Sus),
-		ChordPattern("111000001101", "M7sus2(6,b9,b13)(no5)", L"∆sus2(6,b9,b13)(no5)", Sus),
-		ChordPattern("101000001001", "M7sus2(b13)(no5)", L"∆sus2(b13)(no5)", Sus),
-		ChordPattern("111000000001", "M7sus2(b9)(no5)", L"∆sus2(b9)(no5)", Sus),
-		ChordPattern("111000000101", "M7sus2(b9,13)(no5)", L"∆sus2(b9,13)(no5)", Sus),
-		ChordPattern("111000001001", "M7sus2(b9,b13)(no5)", L"∆sus2(b9,b13)(no5)", Sus),
-		ChordPattern("101000000001", "M7sus2(no5)", L"∆sus2(no5)", Sus),
-		ChordPattern("101000000100", "sus2(13)(no5)", L"sus2(13)(no5)", Sus),
-		ChordPattern("101000001000", "sus2(b13)(no5)", L"sus2(b13)(no5)", Sus),
-		ChordPattern("111000000000", "sus2(b9)(no5)", L"sus2(b9)(no5)", Sus),
-		ChordPattern("111100000000", "sus2(b9,#9)(no5)", L"sus2(b9,#9)(no5)", Sus),
-		ChordPattern("111100100000", "sus2(b9,#9,#11)(no5)", L"sus2(b9,#9,#11)(no5)", Sus),
-		ChordPattern("111100100100", "sus2(b9,#9,#11,13)(no5)", L"sus2(b9,#9,#11,13)(no5)", Sus),
-		ChordPattern("111100101000", "sus2(b9,#9,#11,b13)(no5)", L"sus2alt(no5)", Sus),
-		ChordPattern("111000000100", "sus2(b9,13)(no5)", L"sus2(b9,13)(no5)", Sus),
-		ChordPattern("111000001000", "sus2(b9,b13)(no5)", L"sus2(b9,b13)(no5)", Sus),
-		//suspended 4th (no5)
-		ChordPattern("100001000000", "sus4(no5)", L"sus4(no5)", Sus),
-		ChordPattern("100001001100", "6sus4(b13)(no5)", L"6sus4(b13)(no5)", Sus),
-		ChordPattern("110001001100", "6sus4(b9,b13)(no5)", L"6sus4(b9,b13)(no5)", Sus),
-		ChordPattern("100001100010", "7sus4(#11)(no5)", L"7sus4(#11)(no5)", Sus),
-		ChordPattern("100001100110", "7sus4(#11,13)(no5)", L"7sus4(#11,13)(no5)", Sus),
-		ChordPattern("100001101010", "7sus4(#11,b13)(no5)", L"7sus4(#11,b13)(no5)", Sus),
-		ChordPattern("100001000110", "7sus4(13)(no5)", L"7sus4(13)(no5)", Sus),
-		ChordPattern("100001101110", "7sus4(6,#11,b13)(no5)", L"7sus4(6,#11,b13)(no5)", Sus),
-		ChordPattern("100001001110", "7sus4(6,b13)(no5)", L"7sus4(6,b13)(no5)", Sus),
-		ChordPattern("110001101110", "7sus4(6,b9,#11,b13)(no5)", L"7sus4(6,b9,#11,b13)(no5)", Sus),
-		ChordPattern("100001001010", "7sus4(b13)(no5)", L"7sus4(b13)(no5)", Sus),
-		ChordPattern("110001000010", "7sus4(b9)(no5)", L"7sus4(b9)(no5)", Sus),
-		ChordPattern("110001100010", "7sus4(b9,#11)(no5)", L"7sus4(b9,#11)(no5)", Sus),
-		ChordPattern("110001101010", "7sus4(b9,#11,b13)(no5)", L"7sus4(b9,#11,b13)(no5)", Sus),
-		ChordPattern("110001000110", "7sus4(b9,13)(no5)", L"7sus4(b9,13)(no5)", Sus),
-		ChordPattern("110001001010", "7sus4(b9,b13)(no5)", L"7sus4(b9,b13)(no5)", Sus),
-		ChordPattern("100001000010", "7sus4(no5)", L"7sus4(no5)", Sus),
-		ChordPattern("100001100001", "M7sus4(#11)(no5)", L"∆sus4(#11)(no5)", Sus),
-		ChordPattern("100001100101", "M7sus4(#11,13)(no5)", L"∆sus4(#11,13)(no5)", Sus),
-		ChordPattern("100001101001", "M7sus4(#11,b13)(no5)", L"∆sus4(#11,b13)(no5)", Sus),
-		ChordPattern("100001000101", "M7sus4(13)(no5)", L"∆sus4(13)(no5)", Sus),
-		ChordPattern("100001101101", "M7sus4(6,#11,b13)(no5)", L"∆sus4(6,#11,b13)(no5)", Sus),
-		ChordPattern("100001001101", "M7sus4(6,b13)(no5)", L"∆sus4(6,b13)(no5)", Sus),
-		ChordPattern("110001101101", "M7sus4(6,b9,#11,b13)(no5)", L"∆sus4(6,b9,#11,b13)(no5)", Sus),
-		ChordPattern("110001001101", "M7sus4(6,b9,b13)(no5)", L"∆sus4(6,b9,b13)(no5)", Sus),
-		ChordPattern("100001001001", "M7sus4(b13)(no5)", L"∆sus4(b13)(no5)", Sus),
-		ChordPattern("110001000001", "M7sus4(b9)(no5)", L"∆sus4(b9)(no5)", Sus),
-		ChordPattern("110001100001", "M7sus4(b9,#11)(no5)", L"∆sus4(b9,#11)(no5)", Sus),
-		ChordPattern("110001101001", "M7sus4(b9,#11,b13)(no5)", L"∆sus4(b9,#11,b13)(no5)", Sus),
-		ChordPattern("110001000101", "M7sus4(b9,13)(no5)", L"∆sus4(b9,13)(no5)", Sus),
-		ChordPattern("110001001001", "M7sus4(b9,b13)(no5)", L"∆sus4(b9,b13)(no5)", Sus),
-		ChordPattern("100001000001", "M7sus4(no5)", L"∆sus4(no5)", Sus),
-		ChordPattern("100001100000", "sus4(#11)(no5)", L"sus4(#11)(no5)", Sus),
-		ChordPattern("100001100100", "sus4(#11,13)(no5)", L"sus4(#11,13)(no5)", Sus),
-		ChordPattern("100001101000", "sus4(#11,b13)(no5)", L"sus4(#11,b13)(no5)", Sus),
-		ChordPattern("100001000100", "sus4(13)(no5)", L"sus4(13)(no5)", Sus),
-		ChordPattern("100001001000", "sus4(b13)(no5)", L"sus4(b13)(no5)", Sus),
-		ChordPattern("110001100000", "sus4(b9,#11)(no5)", L"sus4(b9,#11)(no5)", Sus),
-		ChordPattern("110001100100", "sus4(b9,#11,13)(no5)", L"sus4(b9,#11,13)(no5)", Sus),
-		ChordPattern("110001101000", "sus4(b9,#11,b13)(no5)", L"sus4(b9,#11,b13)(no5)", Sus),
-		ChordPattern("110001000100", "sus4(b9,13)(no5)", L"sus4(b9,13)(no5)", Sus),
-		ChordPattern("110001001000", "sus4(b9,b13)(no5)", L"sus4(b9,b13)(no5)", Sus),
-		//major (no3)
-		ChordPattern("100000110100", "(#11,13)(no3)", L"(#11,13)(no3)", Major),
-		ChordPattern("100000111000", "(#11,b13)(no3)", L"(#11,b13)(no3)", Major),
-		ChordPattern("100000110000", "(add#11)(no3)", L"(add#11)(no3)", Major),
-		ChordPattern("100000011000", "(addb13)(no3)", L"(addb13)(no3)", Major),
-		ChordPattern("110000010000", "(addb9)(no3)", L"(addb9)(no3)", Major),
-		ChordPattern("100000100100", "(b5,13)(no3)", L"(b5,13)(no3)", Major),
-		ChordPattern("110000100000", "(b5,b9)(no3)", L"(b5,b9)(no3)", Major),
-		ChordPattern("110000100100", "(b5,b9,13)(no3)", L"(b5,b9,13)(no3)", Major),
-		ChordPattern("110000110000", "(b9,#11)(no3)", L"(b9,#11)(no3)", Major),
-		ChordPattern("110000110100", "(b9,#11,13)(no3)", L"(b9,#11,13)(no3)", Major),
-		ChordPattern("110000111000", "(b9,#11,b13)(no3)", L"(b9,#11,b13)(no3)", Major),
-		ChordPattern("110000010100", "(b9,13)(no3)", L"(b9,13)(no3)", Major),
-		ChordPattern("110000011000", "(b9,b13)(no3)", L"(b9,b13)(no3)", Major),
-		ChordPattern("110001100110", "13(b5,b9)(no3)", L"13(b5,b9)(no3)", Major),
-		ChordPattern("110000110110", "13(b9,#11)(no3)", L"13(b9,#11)(no3)", Major),
-		ChordPattern("100000111100", "6(#11,b13)(no3)", L"6(#11,b13)(no3)", Major),
-		ChordPattern("100000011100", "6(b13)(no3)", L"6(b13)(no3)", Major),
-		ChordPattern("100001101100", "6(b5,11,b13)(no3)", L"6(b5,11,b13)(no3)", Major),
-		ChordPattern("110001101100", "6(b5,b9,11,b13)(no3)", L"6(b5,b9,11,b13)(no3)", Major),
-		ChordPattern("110000011100", "6(b9,b13)(no3)", L"6(b9,b13)(no3)", Major),
-		ChordPattern("100000010100", "6(no3)", L"6(no3)", Major),
-		ChordPattern("100000110010", "7(#11)(no3)", L"7(#11)(no3)", Major),
-		ChordPattern("100000110110", "7(#11,13)(no3)", L"7(#11,13)(no3)", Major),
-		ChordPattern("100000111010", "7(#11,b13)(no3)", L"7(#11,b13)(no3)", Major),
-		ChordPattern("100000010110", "7(13)(no3)", L"7(13)(no3)", Major),
-		ChordPattern("100000111110", "7(6,#11,b13)(no3)", L"7(6,#11,b13)(no3)", Major),
-		ChordPattern("100000011110", "7(6,b13)(no3)", L"7(6,b13)(no3)", Major),
-		ChordPattern("110000111110", "7(6,b9,#11,b13)(no3)", L"7(6,b9,#11,b13)(no3)", Major),
-		ChordPattern("100000011010", "7(b13)(no3)", L"7(b13)(no3)", Major),
-		ChordPattern("100000100010", "7(b5)(no3)", L"7(b5)(no3)", Major),
-		ChordPattern("100000100110", "7(b5,13)(no3)", L"7(b5,13)(no3)", Major),
-		ChordPattern("110000100010", "7(b5,b9)(no3)", L"7(b5,b9)(no3)", Major),
-		ChordPattern("110000100110", "7(b5,b9,13)(no3)", L"7(b5,b9,13)(no3)", Major),
-		ChordPattern("110000010010", "7(b9)(no3)", L"7(b9)(no3)", Major),
-		ChordPattern("110000110010", "7(b9,#11)(no3)", L"7(b9,#11)(no3)", Major),
-		ChordPattern("110000111010", "7(b9,#11,b13)(no3)", L"7(b9,#11,b13)(no3)", Major),
-		ChordPattern("110000010110", "7(b9,13)(no3)", L"7(b9,13)(no3)", Major),
-		ChordPattern("110000011010", "7(b9,b13)(no3)", L"7(b9,b13)(no3)", Major),
-		ChordPattern("100000010010", "7(no3)", L"7(no3)", Major),
-		ChordPattern("110001100101", "M13(b5,b9)(no3)", L"∆13(b5,b9)(no3)", Major),
-		ChordPattern("110000110101", "M13(b9,#11)(no3)", L"∆13(b9,#11)(no3)", Major),
-		ChordPattern("100000110001", "M7(#11)(no3)", L"∆(#11)(no3)", Major),
-		ChordPattern("100000110101", "M7(#11,13)(no3)", L"∆(#11,13)(no3)", Major),
-		ChordPattern("100000111001", "M7(#11,b13)(no3)", L"∆(#11,b13)(no3)", Major),
-		ChordPattern("100000010101", "M7(13)(no3)", L"∆(13)(no3)", Major),
-		ChordPattern("100000111101", "M7(6,#11,b13)(no3)", L"∆(6,#11,b13)(no3)", Major),
-		ChordPattern("100000011101", "M7(6,b13)(no3)", L"∆(6,b13)(no3)", Major),
-		ChordPattern("110000111101", "M7(6,b9,#11,b13)(no3)", L"∆(6,b9,#11,b13)(no3)", Major),
-		ChordPattern("110000011101", "M7(6,b9,b13)(no3)", L"∆(6,b9,b13)(no3)", Major),
-		ChordPattern("100000011001", "M7(b13)(no3)", L"∆(b13)(no3)", Major),
-		ChordPattern("100000100001", "M7(b5)(no3)", L"∆(b5)(no3)", Major),
-		ChordPattern("100000100101", "M7(b5,13)(no3)", L"∆(b5,13)(no3)", Major),
-		ChordPattern("110000100001", "M7(b5,b9)(no3)", L"∆(b5,b9)(no3)", Major),
-		ChordPattern("110000100101", "M7(b5,b9,13)(no3)", L"∆(b5,b9,13)(no3)", Major),
-		ChordPattern("110000010001", "M7(b9)(no3)", L"∆(b9)(no3)", Major),
-		ChordPattern("110000110001", "M7(b9,#11)(no3)", L"∆(b9,#11)(no3)", Major),
-		ChordPattern("110000111001", "M7(b9,#11,b13)(no3)", L"∆(b9,#11,b13)(no3)", Major),
-		ChordPattern("110000010101", "M7(b9,13)(no3)", L"∆(b9,13)(no3)", Major),
-		ChordPattern("110000011001", "M7(b9,b13)(no3)", L"∆(b9,b13)(no3)", Major),
-		ChordPattern("100000010001", "M7(no3)", L"∆(no3)", Major),
-		//augmented (no3)
-		ChordPattern("100000001000", "aug(no3)", L"+(no3)", Aug),
-		ChordPattern("100000101100", "aug(#11,13)(no3)", L"+(#11,13)(no3)", Aug),
-		ChordPattern("100000101000", "aug(add#11)(no3)", L"+(add#11)(no3)", Aug),
-		ChordPattern("110000001000", "aug(addb9)(no3)", L"+(addb9)(no3)", Aug),
-		ChordPattern("110000101000", "aug(b9,#11)(no3)", L"+(b9,#11)(no3)", Aug),
-		ChordPattern("110000101100", "aug(b9,#11,13)(no3)", L"+(b9,#11,13)(no3)", Aug),
-		ChordPattern("110000001100", "aug(b9,13)(no3)", L"+(b9,13)(no3)", Aug),
-		ChordPattern("110000101101", "aug(M13)(b9,#11)(no3)", L"+∆13(b9,#11)(no3)", Aug),
-		ChordPattern("100000101001", "aug(M7)(#11)(no3)", L"+∆(#11)(no3)", Aug),
-		ChordPattern("100000101101", "aug(M7)(#11,13)(no3)", L"+∆(#11,13)(no3)", Aug),
-		ChordPattern("100000001101", "aug(M7)(13)(no3)", L"+∆(13)(no3)", Aug),
-		ChordPattern("110000001001", "aug(M7)(b9)(no3)", L"+∆(b9)(no3)", Aug),
-		ChordPattern("110000101001", "aug(M7)(b9,#11)(no3)", L"+∆(b9,#11)(no3)", Aug),
-		ChordPattern("110000001101", "aug(M7)(b9,13)(no3)", L"+∆(b9,13)(no3)", Aug),
-		ChordPattern("100000001001", "aug(M7)(no3)", L"+∆(no3)", Aug),
-		ChordPattern("110001001110", "aug13(b9)(no3)", L"+13(b9)(no3)", Aug),
-		ChordPattern("110000101110", "aug13(b9,#11)(no3)", L"+13(b9,#11)(no3)", Aug),
-		ChordPattern("100000001100", "aug6(no3)", L"+6(no3)", Aug),
-		ChordPattern("100000101010", "aug7(#11)(no3)", L"+7(#11)(no3)", Aug),
-		ChordPattern("100000101110", "aug7(#11,13)(no3)", L"+7(#11,13)(no3)", Aug),
-		ChordPattern("100000001110", "aug7(13)(no3)", L"+7(13)(no3)", Aug),
-		ChordPattern("110000001010", "aug7(b9)(no3)", L"+7(b9)(no3)", Aug),
-		ChordPattern("110000101010", "aug7(b9,#11)(no3)", L"+7(b9,#11)(no3)", Aug),
-		ChordPattern("110000001110", "aug7(b9,13)(no3)", L"+7(b9,13)(no3)", Aug),
-		ChordPattern("100000001010", "aug7(no3)", L"+7(no3)", Aug),
-		//easter egg
-		ChordPattern("111111111111", "-Easter Egg", L"Easter Egg", EasterEgg),
-	};
+		int mask = patternList[patternIndex].mask;
+		if (patternLookup[mask] == -1)
+			patternLookup[mask] = (int16)patternIndex;
+	}
+	return patternLookup;
+}
+
+//index into patternList for each 12 bit pitch class mask, -1 if there's no match
+static constexpr std::array<int16, 4096> patternLookup = createPatternLookup();
 
-	for (ChordPattern pattern : patternList)
+/*
+* For every set of pitch classes (relative to the bass note) find the first inversion that matches a pattern,
+* trying the bass note first and then each chord note going upwards, like raising the bass note an octave at a time
+*/
+static constexpr std::array<ChordResolution, 4096> createResolutions()
+{
+	std::array<ChordResolution, 4096> resolutions {};
+	for (int chordMask = 1; chordMask < 4096; chordMask += 2)
 	{
-		this->patterns.insert({ pattern.pattern, pattern });
+		for (int rootOffset = 0; rootOffset < 12; rootOffset++)
+		{
+			if ((chordMask & (1 << rootOffset)) == 0)
+				continue;
+
+			int rotatedMask = ((chordMask >> rootOffset) | (chordMask << (12 - rootOffset))) & 0xFFF;
+			if (patternLookup[rotatedMask] >= 0)
+			{
+				resolutions[chordMask].patternIndex = patternLookup[rotatedMask];
+				resolutions[chordMask].rootOffset = (int8)rootOffset;
+				break;
+			}
+		}
 	}
-}
\ No newline at end of file
+	return resolutions;
+}
+
+//indexed by pitch class mask relative to the bass note
+static constexpr std::array<ChordResolution, 4096> resolutions = createResolutions();
+
+const ChordPattern& Chords::getPattern(int patternIndex)
+{
+	return patternList[patternIndex];
+}
+
+int Chords::getNumPatterns()
+{
+	return numPatterns;
+}
+
+//Strings for the pattern names are created once, so naming a chord never has to convert them again
+const String& Chords::getPatternName(int patternIndex, bool shortName)
+{
+	static const std::vector<String> names = []
+	{
+		std::vector<String> result;
+		result.reserve(numPatterns * 2);
+		for (const ChordPattern& pattern : patternList)
+		{
+			result.push_back(String(pattern.name));
+			result.push_back(String(pattern.shortName));
+		}
+		return result;
+	}();
+	return names[(size_t)(patternIndex * 2 + (shortName ? 1 : 0))];
+}
+
+const ChordResolution& Chords::getResolution(int chordMask)
+{
+	return resolutions[chordMask];
+}
@@ -0,0 +1,74 @@
+/*
+  ==============================================================================
+
+   This file is part of the GrandStaffMIDIVisualizer plugin code.
+   Copyright (c) Brynjar Reynisson
+
+   The code included in this file is provided under the terms of the ISC license
+   http://www.isc.org/downloads/software-support-policy/isc-license. Permission
+   to use, copy, modify, and/or distribute this software for any purpose with or
+   without fee is hereby granted provided that the above copyright notice and
+   this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+   REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+   AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+   INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+   LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+   OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+   PERFORMANCE OF THIS SOFTWARE.
+
+  ==============================================================================
+*/
+
+
+#include "MainComponent.h"
+
+void ChordTextCache::draw(Graphics& g, const String& text, const Font& font, Colour colour, Rectangle<float> area, Justification justification)
+{
+    if (text.isEmpty() || !g.clipRegionIntersects(area.getSmallestIntegerContainer()))
+        return;
+
+    Entry* entry = nullptr;
+    for (Entry& candidate : entries)
+    {
+        if (candidate.used && candidate.text == text && candidate.font == font && candidate.width == area.getWidth() &&
+            candidate.height == area.getHeight() && candidate.justification == justification.getFlags())
+        {
+            entry = &candidate;
+            break;
+        }
+    }
+
+    if (entry == nullptr)
+    {
+        //same attributes as the chord name always had, only laid out when something changes
+        AttributedString chordStr;
+        chordStr.setText(text);
+        chordStr.setColour(colour);
+        chordStr.setFont(font);
+        chordStr.setWordWrap(juce::AttributedString::WordWrap::none);
+        chordStr.setJustification(justification);
+
+        entry = &entries[nextEntry];
+        nextEntry = (nextEntry + 1) % numEntries;
+        entry->text = text;
+        entry->font = font;
+        entry->width = area.getWidth();
+        entry->height = area.getHeight();
+        entry->justification = justification.getFlags();
+        entry->colour = colour;
+        entry->layout.createLayout(chordStr, area.getWidth());
+        entry->used = true;
+    }
+    else if (entry->colour != colour)
+    {
+        //fading out only changes the colour, no need to lay out the text again
+        for (int i = 0; i < entry->layout.getNumLines(); i++)
+            for (TextLayout::Run* run : entry->layout.getLine(i).runs)
+                run->colour = colour;
+        entry->colour = colour;
+    }
+
+    entry->layout.draw(g, area);
+}
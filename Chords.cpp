@@ -24,56 +24,51 @@
 #include "MainComponent.h"
 #include <random>
 
-Chord::Chord(ChordPattern pattern, String rootNote, String bassNote)
+String Chord::name(bool shortName) const
 {
-	this->pattern = pattern;
-	this->rootNote = rootNote;
-	this->bassNote = bassNote;
-};
+	if (isNull())
+		return {};
 
-String Chord::name(bool shortName)
-{
-	if (pattern.chordType == EasterEgg)
-		return pattern.name;
+	if (chordType == EasterEgg)
+		return Chords::getEasterEggName(easterEgg);
 
-	String chordName = rootNote;
-	chordName += shortName ? pattern.shortName : pattern.name;
-	if (bassNote.length() > 0)
+	String chordName = getRootName();
+	chordName += Chords::getPatternName(patternIndex, shortName);
+	if (bassNote >= 0)
 	{
 		chordName += "/";
-		chordName += bassNote;
+		chordName += getBassName();
 	}
 	return chordName;
 }
 
-static bool chordIndexSet(String& string, int idx)
+const ChordPattern& Chord::getPattern() const
 {
-	String subStr = string.substring(idx, idx + 1);
-	return subStr == "1";
+	return isNull() ? nullPattern : Chords::getPattern(patternIndex);
 }
 
-void ChordPattern::init()
+const String& Chord::getRootName() const
 {
-	if (chordIndexSet(pattern, 1))
-		flat9 = true;
-	if (chordType != Tritonic && chordIndexSet(pattern, 6))
-		flat5 = true;
-	if (name.contains("b11"))
-		flat11 = true;
-	if (name.contains("b13"))
-		flat13 = true;
-	if (chordType == Aug)
-		sharp5 = true;
-	if (chordType != Minor && chordType != Dim && chordIndexSet(pattern, 3))
-		sharp9 = true;
-	if (name.contains("#11"))
-	{
-		sharp11 = true;
-		flat5 = false;
-	}
+	return Chords::getNoteName(rootNote, rootSharp);
+}
+
+const String& Chord::getBassName() const
+{
+	return Chords::getNoteName(bassNote, bassSharp);
 }
 
-static std::vector<String> easterEggs =
+const String& Chords::getNoteName(int pitchClass, bool sharp)
+{
+	static const String emptyName;
+	static const String sharpNames[] = { "C", "C#", "D", "D#", "E", "F", "F#", "G", "G#", "A", "A#", "B" };
+	static const String flatNames[] = { "C", "Db", "D", "Eb", "E", "F", "Gb", "G", "Ab", "A", "Bb", "B" };
+
+	if (pitchClass < 0)
+		return emptyName;
+	return sharp ? sharpNames[pitchClass] : flatNames[pitchClass];
+}
+
+static const char* const easterEggs[] =
 {
 	" Madness!",
 	" You think this is a good idea?",
@@ -89,18 +84,19 @@ static std::vector<String> easterEggs =
 static 	std::random_device rand_dev;
 static std::mt19937 generator(rand_dev());
 static const int range_from = 0;
-static const int range_to = easterEggs.size() - 1;
+static const int range_to = numElementsInArray(easterEggs) - 1;
 static std::uniform_int_distribution<int>  distr(range_from, range_to);
 
-static String randomEasterEgg()
+const String& Chords::getEasterEggName(int easterEgg)
 {
-	return easterEggs[distr(generator)];
+	static const std::vector<String> easterEggNames(std::begin(easterEggs), std::end(easterEggs));
+	return easterEggNames[(size_t)easterEgg];
 }
 
 static ChordType lastChordType = None;
-static String lastEasterEggName = "";
+static int8 lastEasterEgg = 0;
 
-void Chords::name(std::set<int>& midiNotes, Key& key, Chord& chord)
+void Chords::name(std::set<int>& midiNotes, const Key& key, Chord& chord)
 {
 	if (midiNotes.size() < 2)
 	{
@@ -108,176 +104,105 @@ void Chords::name(std::set<int>& midiNotes, Key& key, Chord& chord)
 		return;
 	}
 
-	String sharpSymbol = MidiMessage::getMidiNoteName(1, true, false, 3).substring(1);
-	String flatSymbol = MidiMessage::getMidiNoteName(1, false, false, 3).substring(1);
-
 	int bassNote = *(midiNotes.begin()) % 12;
-	int highestNote = *(midiNotes.rbegin()) % 12;
-
-	bool notes[36] = { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 };
-	notes[bassNote] = true;
 
+	//pitch classes relative to the bass note, bit 0 is always the bass note
+	int chordMask = 0;
 	for (int midiNote : midiNotes)
-	{
-		int condensedNote = midiNote % 12;
-		if (condensedNote < bassNote)
-			condensedNote += 12;
-		notes[condensedNote] = true;
-	}
+		chordMask |= 1 << ((midiNote % 12 - bassNote + 12) % 12);
+
+	//the resolution table already knows which inversion (if any) matches a pattern
+	const ChordResolution& resolution = getResolution(chordMask);
+	if (resolution.patternIndex < 0)
+		return;
+	if (resolution.rootOffset != 0 && midiNotes.size() < 3) //we don't want to find bass notes for 2 note chords
+		return;
 
-	int curBassNote = -1;
-	String chordName = "";
-	for (int outerIdx = 0; outerIdx < 36; outerIdx++)
+	int chordRootNote = (bassNote + resolution.rootOffset) % 12;
+	chord.patternIndex = resolution.patternIndex;
+	chord.chordType = getPattern(resolution.patternIndex).chordType;
+	chord.rootNote = (int8)chordRootNote;
+	if (key.name == Key::SHARPS)
+		chord.rootSharp = true;
+	else if(key.name == Key::FLATS)
+		chord.rootSharp = false;
+	else
 	{
-		int innerIdx = 0;
-		for (; innerIdx < 36; innerIdx++)
-		{
-			if (notes[innerIdx])
-			{
-				break;
-			}
-		}
-		//innerIdx is the lowest note in the chord
-		curBassNote = innerIdx;
-		String chordMatcher = "";
-		for (; innerIdx < curBassNote + 12; innerIdx++)
-		{
-			chordMatcher += notes[innerIdx] ? "1" : "0";
-		}
-		//loop over truths to see if current matches
-		for (std::map<String, ChordPattern>::iterator it = patterns.begin(); it != patterns.end(); ++it)
-		{
-			if (it->first == chordMatcher)
-			{
-				chord.pattern = it->second;
-				if (key.name == Key::SHARPS)
-					chord.rootNote = MidiMessage::getMidiNoteName(curBassNote, true, false, 3);
-				else if(key.name == Key::FLATS)
-					chord.rootNote = MidiMessage::getMidiNoteName(curBassNote, false, false, 3);
-				else
-				{
-
-					ChordPattern chordPattern = it->second;
-					chord.rootNote = key.selectChordBaseNoteName(curBassNote, chordPattern.chordType);
-					//TODO, add midi notes to Chord once that's part of the signature
-				}
-				break;
-			}
-		}
-		if (chord.rootNote == "" && midiNotes.size() > 2) //we don't want to find bass notes for 2 note chords
-		{
-			//raise the cur bass note by 12 and try again
-			notes[curBassNote] = false;
-			if(curBassNote + 12 < 36)
-				notes[curBassNote + 12] = true;
-			else
-			{
-				return;
-			}
-		}
-		else
-			break;
+		chord.rootSharp = key.useSharpForChordBaseNote(chordRootNote, chord.chordType);
+		//TODO, add midi notes to Chord once that's part of the signature
 	}
-	if (chord.pattern.pattern.length() == 0)
-		return;
+	//natural notes are spelled the same either way, keep the flag meaningful for accented notes only
+	chord.rootSharp = chord.rootSharp && isAccentedPitchClass(chordRootNote);
 
-	if (chord.pattern.chordType == EasterEgg)
+	if (chord.chordType == EasterEgg)
 	{
 		if (lastChordType != EasterEgg)
-		{
-			lastEasterEggName = randomEasterEgg();
-			
-		}
-		chord.pattern.name = lastEasterEggName;		
+			lastEasterEgg = (int8)distr(generator);
+		chord.easterEgg = lastEasterEgg;
 	}
 	
-	lastChordType = chord.pattern.chordType;
+	lastChordType = chord.chordType;
 
 	//see if the bass note is not the same as the chord base note
-	if (bassNote == curBassNote)
+	if (bassNote == chordRootNote)
 		return;
 
+	chord.bassNote = (int8)bassNote;
 	if (key.name == Key::SHARPS)
-		chord.bassNote = MidiMessage::getMidiNoteName(bassNote, true, false, 3);
+		chord.bassSharp = true;
 	else if (key.name == Key::FLATS)
-		chord.bassNote = MidiMessage::getMidiNoteName(bassNote, false, false, 3);
+		chord.bassSharp = false;
 	else
 	{
 		//Some chords decide their own bass note name, others respect the key we're in
 		if (chordHasSuperPower(chord))
-		{
-			bool sharp = isChordSharp(chord);
-			chord.bassNote = MidiMessage::getMidiNoteName(bassNote, sharp, false, 4);
-		}
+			chord.bassSharp = isChordSharp(chord);
 		else
-		{
-			chord.bassNote = MidiMessage::getMidiNoteName(bassNote, key.numSharps > 0, false, 4);
-		}
+			chord.bassSharp = key.numSharps > 0;
 	}
+	chord.bassSharp = chord.bassSharp && isAccentedPitchClass(bassNote);
 }
 
-static std::map<String, int> noteNameToMidiNote
-{
-	{ "C", 0 },
-	{ "C#", 1 },
-	{ "Db", 1 },
-	{ "D", 2 },
-	{ "D#", 3 },
-	{ "Eb", 3 },
-	{ "E", 4 },
-	{ "F", 5 },
-	{ "F#", 6 },
-	{ "Gb", 6 },
-	{ "G", 7 },
-	{ "G#", 8 },
-	{ "Ab", 8 },
-	{ "A", 9 },
-	{ "A#", 10 },
-	{ "Bb", 10 },
-	{ "B", 11}
-};
-
-static bool isSpecialFlatOrSharp(Chord& chord, bool testVar, int midiNote, int distanceFromC)
+static bool isSpecialFlatOrSharp(const Chord& chord, bool testVar, int midiNote, int distanceFromC)
 {
 	if (!testVar)
 		return false;
 
-	int rootMidiNote = noteNameToMidiNote[chord.rootNote];
 	int remains = midiNote % 12;
-	return remains == rootMidiNote + distanceFromC;
+	return remains == chord.rootNote + distanceFromC;
 }
 
-bool Chord::isFlat5(int midiNote)
+bool Chord::isFlat5(int midiNote) const
 {
-	return isSpecialFlatOrSharp(*this, pattern.flat5, midiNote, 6);
+	return isSpecialFlatOrSharp(*this, getPattern().flat5, midiNote, 6);
 }
 
-bool Chord::isFlat9(int midiNote)
+bool Chord::isFlat9(int midiNote) const
 {
-	return isSpecialFlatOrSharp(*this, pattern.flat9, midiNote, 1);
+	return isSpecialFlatOrSharp(*this, getPattern().flat9, midiNote, 1);
 }
 
-bool Chord::isFlat11(int midiNote)
+bool Chord::isFlat11(int midiNote) const
 {
-	return isSpecialFlatOrSharp(*this, pattern.flat11, midiNote, 4);
+	return isSpecialFlatOrSharp(*this, getPattern().flat11, midiNote, 4);
 }
 
-bool Chord::isFlat13(int midiNote)
+bool Chord::isFlat13(int midiNote) const
 {
-	return isSpecialFlatOrSharp(*this, pattern.flat13, midiNote, 8);
+	return isSpecialFlatOrSharp(*this, getPattern().flat13, midiNote, 8);
 }
 
-bool Chord::isSharp5(int midiNote)
+bool Chord::isSharp5(int midiNote) const
 {
-	return isSpecialFlatOrSharp(*this, pattern.sharp5, midiNote, 8);
+	return isSpecialFlatOrSharp(*this, getPattern().sharp5, midiNote, 8);
 }
 
-bool Chord::isSharp9(int midiNote)
+bool Chord::isSharp9(int midiNote) const
 {
-	return isSpecialFlatOrSharp(*this, pattern.sharp9, midiNote, 3);
+	return isSpecialFlatOrSharp(*this, getPattern().sharp9, midiNote, 3);
 }
 
-bool Chord::isSharp11(int midiNote)
+bool Chord::isSharp11(int midiNote) const
 {
-	return isSpecialFlatOrSharp(*this, pattern.sharp11, midiNote, 6);
+	return isSpecialFlatOrSharp(*this, getPattern().sharp11, midiNote, 6);
 }
\ No newline at end of file
@@ -84,27 +84,27 @@ void CustomLookAndFeel::setDarkModeLookAndFeel()
 
 Font CustomLookAndFeel::getTextButtonFont(TextButton& textButton, int buttonHeight)
 {
-    return plainCustomFont.withHeight(buttonHeight * fontHeightMultiplier);
+    return resources->getFont(false).withHeight(buttonHeight * fontHeightMultiplier);
 }
 
 Font CustomLookAndFeel::getLabelFont(Label& l)
 {
-    return plainCustomFont.withHeight(l.getBounds().getHeight() * fontHeightMultiplier);
+    return resources->getFont(false).withHeight(l.getBounds().getHeight() * fontHeightMultiplier);
 }
 
 Font CustomLookAndFeel::getComboBoxFont(ComboBox& c)
 {
-    return plainCustomFont.withHeight(c.getBounds().getHeight() * fontHeightMultiplier);
+    return resources->getFont(false).withHeight(c.getBounds().getHeight() * fontHeightMultiplier);
 }
 
 Font CustomLookAndFeel::getPopupMenuFont()
 {
-    return plainCustomFont;
+    return resources->getFont(false);
 }
 
 Typeface::Ptr CustomLookAndFeel::getTypefaceForFont(const Font& f)
 {
-    return customFontTypeface;
+    return resources->getTypeface();
 }
 
 void CustomLookAndFeel::drawRotarySlider(Graphics& g, int x, int y, int width, int height, float sliderPos,
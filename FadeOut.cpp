@@ -82,7 +82,7 @@ void FadeOut::stop()
 
 Colour FadeOut::getColour()
 {
-    return model->darkMode ? dmChordColours[colourIndex] : lmChordColours[colourIndex];
+    return model->getSettings().darkMode ? dmChordColours[colourIndex] : lmChordColours[colourIndex];
 }
 
 std::function<float(float)> FadeOut::createFadeOutIndexes()
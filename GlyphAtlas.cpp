@@ -0,0 +1,98 @@
+/*
+  ==============================================================================
+
+   This file is part of the GrandStaffMIDIVisualizer plugin code.
+   Copyright (c) Brynjar Reynisson
+
+   The code included in this file is provided under the terms of the ISC license
+   http://www.isc.org/downloads/software-support-policy/isc-license. Permission
+   to use, copy, modify, and/or distribute this software for any purpose with or
+   without fee is hereby granted provided that the above copyright notice and
+   this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+   REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+   AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+   INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+   LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+   OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+   PERFORMANCE OF THIS SOFTWARE.
+
+  ==============================================================================
+*/
+
+
+#include "MainComponent.h"
+
+void GlyphAtlas::setDrawables(const std::array<Drawable*, numGlyphs>& glyphDrawables)
+{
+    if (glyphDrawables == drawables)
+        return;
+    drawables = glyphDrawables;
+    scale = 0; //forces a rebuild
+}
+
+//the same boxes NotationLayout::build places the glyphs within
+Rectangle<float> GlyphAtlas::getGlyphBox(Glyph glyph) const
+{
+    switch (glyph)
+    {
+    case noteHead:
+        return { 0, 0, noteWidth, noteHeight + lineThickness * 4 };
+    case doubleSharp:
+        return { 0, 0, noteWidth, noteHeight };
+    default:
+        return { 0, 0, noteWidth, noteHeight * 2.5f };
+    }
+}
+
+void GlyphAtlas::update(const StaffCalculator& staffCalculator, float pixelScale)
+{
+    if (staffCalculator.noteWidth == noteWidth && staffCalculator.noteHeight == noteHeight &&
+        staffCalculator.lineThickness == lineThickness && pixelScale == scale)
+        return;
+
+    noteWidth = staffCalculator.noteWidth;
+    noteHeight = staffCalculator.noteHeight;
+    lineThickness = staffCalculator.lineThickness;
+    scale = pixelScale;
+
+    //one cell per glyph, with a pixel of padding so that neighbours don't bleed into each other
+    int cellWidths[numGlyphs];
+    int cellHeights[numGlyphs];
+    int atlasWidth = 0;
+    int rowHeight = 0;
+    for (int glyph = 0; glyph < numGlyphs; glyph++)
+    {
+        Rectangle<float> box = getGlyphBox((Glyph)glyph);
+        cellWidths[glyph] = std::max(1, (int)std::ceil(box.getWidth() * scale));
+        cellHeights[glyph] = std::max(1, (int)std::ceil(box.getHeight() * scale));
+        atlasWidth += cellWidths[glyph] + 1;
+        rowHeight = std::max(rowHeight, cellHeights[glyph] + 1);
+    }
+
+    atlas = Image(Image::ARGB, atlasWidth, rowHeight, true);
+    Graphics g(atlas);
+    int cellX = 0;
+    for (int glyph = 0; glyph < numGlyphs; glyph++)
+    {
+        if (drawables[glyph] != nullptr)
+        {
+            Graphics::ScopedSaveState saveState(g);
+            g.addTransform(AffineTransform::scale(scale).translated((float)cellX, 0.0f));
+            drawables[glyph]->drawWithin(g, getGlyphBox((Glyph)glyph), RectanglePlacement::Flags::xLeft, 1.0);
+        }
+        glyphImages[glyph] = atlas.getClippedImage({ cellX, 0, cellWidths[glyph], cellHeights[glyph] });
+        cellX += cellWidths[glyph] + 1;
+    }
+}
+
+void GlyphAtlas::draw(Graphics& g, Glyph glyph, float x, float y) const
+{
+    const Image& image = glyphImages[glyph];
+    if (image.isNull())
+        return;
+
+    //cells are rounded up to whole pixels, so the destination is sized from the image rather than the glyph box
+    g.drawImage(image, Rectangle<float>(x, y, image.getWidth() / scale, image.getHeight() / scale));
+}
@@ -69,7 +69,6 @@ public:
         pluginModel { PluginModel() },
         vstParameters(*this, pluginModel)
     {
-        pluginModel.resetMidiNotes();
         editor = nullptr;        
     }
 
@@ -78,8 +77,17 @@ public:
     void processBlock (AudioBuffer<float>& audio,  MidiBuffer& midi) override 
     {
         audio.clear();
-        ScopedLock lock(pluginModel.criticalSection);
         bool hasMidiChanges = false;
+        //one copy per block, a host or editor change lands in the next one
+        const PluginSettings settings = pluginModel.getSettings();
+
+        int resetRequests = pluginModel.midiNotesResetRequests.load();
+        if (resetRequests != lastResetRequests)
+        {
+            lastResetRequests = resetRequests;
+            activeNotes.clear();
+            hasMidiChanges = true;
+        }
 
         Optional<AudioPlayHead::PositionInfo> result = getPlayHead()->getPosition();
         if (result.hasValue())
@@ -87,9 +95,9 @@ public:
             if (result->getIsPlaying() || result->getIsRecording())
             {
                 unsigned __int64 now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
-                if (pluginModel.holdNotes && now > lastPlayTime + 1000)
+                if (settings.holdNotes && now > lastPlayTime + 1000)
                 {
-                    pluginModel.resetMidiNotes();
+                    activeNotes.clear();
                     hasMidiChanges = true;
                 }
                 lastPlayTime = now;
@@ -99,26 +107,41 @@ public:
         for (const MidiMessageMetadata metadata : midi)
         {
             int noteNumber = metadata.getMessage().getNoteNumber();
-            if (!pluginModel.holdNotes)
+            if (metadata.getMessage().isNoteOnOrOff())
+            {
+                MidiNoteEvent event;
+                event.samplePosition = samplesProcessed + metadata.samplePosition;
+                event.note = (int8)noteNumber;
+                event.velocity = metadata.getMessage().getVelocity();
+                event.on = metadata.getMessage().isNoteOn();
+                event.channel = (int8)metadata.getMessage().getChannel();
+                pluginModel.midiEvents.push(event);
+            }
+
+            if (!settings.holdNotes)
             {
                 if (metadata.getMessage().isNoteOn() || metadata.getMessage().isNoteOff())
                 {
                     bool onOff = metadata.getMessage().isNoteOn();
-                    pluginModel.midiNotes[noteNumber] = onOff;
+                    activeNotes.set(noteNumber, onOff);
                     hasMidiChanges = true;
                 }
             }
-            else if (pluginModel.holdNotes && metadata.getMessage().isNoteOn())
+            else if (settings.holdNotes && metadata.getMessage().isNoteOn())
             {
-                bool currentlyOn = pluginModel.midiNotes[noteNumber];
-                pluginModel.midiNotes[noteNumber] = !currentlyOn;
+                bool currentlyOn = activeNotes.test(noteNumber);
+                activeNotes.set(noteNumber, !currentlyOn);
                 hasMidiChanges = true;
             }
         }
 
-        if (hasMidiChanges && editor != nullptr)
+        samplesProcessed += audio.getNumSamples();
+        if (hasMidiChanges)
         {
-            editor->postCommandMessage(CMD_MSG_MIDI_CHANGES);
+            //the editor picks this up on its next display refresh, no message is posted from here
+            pluginModel.midiNotes.write(activeNotes);
+            pluginModel.midiNotesResetsHandled = lastResetRequests;
+            pluginModel.midiChangeCount++;
         }
     }
 
@@ -164,8 +187,10 @@ private:
         {
             setResizable (true, true);
             addAndMakeVisible(mainComponent);
-            if (owner.pluginModel.uiWidth > 0 && owner.pluginModel.uiHeight > 0)
-                setSize(owner.pluginModel.uiWidth, owner.pluginModel.uiHeight);
+            int width = owner.pluginModel.uiWidth.load();
+            int height = owner.pluginModel.uiHeight.load();
+            if (width > 0 && height > 0)
+                setSize(width, height);
             else
                 setSize(500, 500);
 
@@ -179,14 +204,14 @@ private:
 
         void paint (Graphics& g) override
         {
-            g.fillAll (owner.pluginModel.darkMode ? darkModeBackgroundColour : Colours::white);
+            g.fillAll (owner.pluginModel.getSettings().darkMode ? darkModeBackgroundColour : Colours::white);
         }
 
         void resized() override
         {
             auto bounds = getLocalBounds();
             
-            if (owner.pluginModel.chordPlacement != 3)
+            if (owner.pluginModel.getSettings().chordPlacement != 3)
             {
                 constrainer.setMinimumWidth(std::max((int)(bounds.getHeight() * 0.85), 230));
                 constrainer.setMinimumHeight(260);
@@ -214,8 +239,6 @@ private:
             }
             if (commandId == CMD_MSG_VST_PARAM_CHANGES)
                 mainComponent.onParametersChanged();
-            else if (commandId == CMD_MSG_MIDI_CHANGES)
-                mainComponent.onMidiChanged();
             repaint();
         }
 
@@ -262,6 +285,9 @@ private:
     PluginModel pluginModel;
     VSTParameters vstParameters;
     unsigned __int64 lastPlayTime = 0;
+    NoteMask activeNotes; //only touched by the audio thread
+    int lastResetRequests = 0;
+    int64 samplesProcessed = 0;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (GrandStaffMIDIVisualizerProcessor)
 };
\ No newline at end of file
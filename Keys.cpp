@@ -23,349 +23,336 @@
 
 #include "MainComponent.h"
 
-bool Key::hasNote(String& noteName)
+bool Key::useSharpForChordBaseNote(int midiNote, ChordType chordType) const
 {
-	for (String curNote : notes)
-	{
-		if (curNote == noteName)
-			return true;	
-	}
-	return false;
-}
-
-String Key::selectChordBaseNoteName(int midiNote, ChordType chordType)
-{
-	String noteNameSharp = MidiMessage::getMidiNoteName(midiNote, true, false, 4);
-	String noteNameFlat = MidiMessage::getMidiNoteName(midiNote, false, false, 4);
+	int pitchClass = midiNote % 12;
 
-	if (chordType == Dim && noteNameSharp.length() == 2)
+	if (chordType == Dim && isAccentedPitchClass(pitchClass))
 	{
 		//Dims with accented root note are always sharp, otherwise they would need to be full of double flats
-		return noteNameSharp;
+		return true;
 	}
-	else if (chordType == Major && (noteNameSharp == "D#" || noteNameSharp == "A#"))
+	else if (chordType == Major && (pitchClass == 3 || pitchClass == 10))
 	{
 		//D# loses because of F## and A# loses because of C##
-		return noteNameFlat;
+		return false;
 	}
-	else if ((chordType == Minor || chordType == Dim) && noteNameFlat == "Gb")
+	else if ((chordType == Minor || chordType == Dim) && pitchClass == 6)
 	{
 		//Gbm and Gbdim lose because of Bbb
-		return noteNameSharp;
+		return true;
 	}
 
-	if (numSharps == 0)
-	{
-		return noteNameFlat;
-	}
-	else {
-		return noteNameSharp;
-	}
+	return numSharps != 0;
 }
 
 Keys::Keys()
 {
-	addKey("C", std::list<String>({ "C","D","E","F","G","A","B" }), 0, 0);
-	addKey("C#", std::list<String>({ "C#","D#","E#","F#","G#","A#","B#" }), 7, 0);
-	addKey("Db", std::list<String>({ "Db","Eb","F", "Gb","Ab","Bb","C" }), 0, 5);
-	addKey("D", std::list<String>({ "D","E","F#","G","A","B","C#"}), 2, 0);
-	//D# not supported, has two double sharps
-	addKey("Eb", std::list<String>({ "Eb","F", "G","Ab","Bb","C","D"}), 0, 3);
-	addKey("E", std::list<String>({ "E","F#","G#","A","B","C#","D#"}), 4, 0);
-	addKey("F", std::list<String>({ "F","G","A","Bb","C","D","E" }), 0, 1);
-	addKey("F#", std::list<String>({ "F#","G#","A#","B","C#","D#","E#" }), 6, 0);
-	addKey("Gb", std::list<String>({ "Gb","Ab","Bb","Cb","Db","Eb","F" }), 0, 6);
-	addKey("G", std::list<String>({ "G","A","B","C","D","E","F#" }), 1, 0);
-	//G# not supported, has a double sharp
-	addKey("Ab", std::list<String>({ "Ab","Bb","C","Db","Eb","F","G"}), 0, 4);
-	addKey("A", std::list<String>({ "A","B","C#","D","E","F#","G#"}), 3, 0);
-	//A# not supported, 3 double sharps
-	addKey("Bb", std::list<String>({ "Bb","C","D","Eb","F","G","A"}), 0, 2);
-	addKey("B", std::list<String>({ "B","C#","D#","E","F#","G#","A#"}), 5, 0);		
-
-	addKey("Sharps", std::list<String>({ "C","D","E","F","G","A","B" }), 0, 0);
-	addKey("Flats", std::list<String>({ "C","D","E","F","G","A","B" }), 0, 0);
+	//ids are the order keys are added in, and sessions save them, so new keys only ever go at the end
+	addKey("C", 0);
+	addKey("C#", 7);
+	addKey("Db", -5);
+	addKey("D", 2);
+	addKey("Eb", -3);
+	addKey("E", 4);
+	addKey("F", -1);
+	addKey("F#", 6);
+	addKey("Gb", -6);
+	addKey("G", 1);
+	addKey("Ab", -4);
+	addKey("A", 3);
+	addKey("Bb", -2);
+	addKey("B", 5);
+
+	addKey("Sharps", 0);
+	addKey("Flats", 0);
+
+	addKey("Cb", -7);
+	//theoretical keys, the key signature has double sharps
+	addKey("G#", 8);
+	addKey("D#", 9);
+	addKey("A#", 10);
+
+	addKey("Cm", -3, true);
+	addKey("C#m", 4, true);
+	addKey("Dm", -1, true);
+	addKey("D#m", 6, true);
+	addKey("Ebm", -6, true);
+	addKey("Em", 1, true);
+	addKey("Fm", -4, true);
+	addKey("F#m", 3, true);
+	addKey("Gm", -2, true);
+	addKey("G#m", 5, true);
+	addKey("Abm", -7, true);
+	addKey("Am", 0, true);
+	addKey("A#m", 7, true);
+	addKey("Bbm", -5, true);
+	addKey("Bm", 2, true);
+
+	buildSpellingTable();
 }
 
-void Keys::addKey(String name, std::list<String>& notes, int numSharps, int numFlats)
+/*
+* Notes are spelled by their position on the line of fifths, counted in fifths up from C: F is -1, G is 1, F# is 6, Bb is -2
+* and F## is 13. Positions twelve apart are the same pitch class, so any twelve positions in a row name each pitch class once.
+*/
+static int floorDiv(int value, int divisor)
 {
-	Key key;
-	key.name = name;
-	key.notes = notes;
-	key.numSharps = numSharps;
-	key.numFlats = numFlats;
-	keys[name] = key;
-	keyNames.push_back(name);
-};
+	return value >= 0 ? value / divisor : -((divisor - 1 - value) / divisor);
+}
 
-int Keys::getKeyIndex(String name)
+//0 is C and 6 is B
+static int getLetter(int fifths)
 {
-	for (int idx = 0; idx < keyNames.size(); idx++)
-	{
-		if (keyNames.at(idx) == name)
-			return idx;
-	}
-	return -1;
+	return (fifths * 4 % 7 + 7) % 7;
 }
 
-std::vector<String> Keys::getKeyNames()
+//-1 is flat, 1 is sharp and 2 a double sharp
+static int getAlteration(int fifths)
 {
-	return keyNames;
+	return floorDiv(fifths + 1, 7);
 }
 
-Key Keys::getKey(String name)
+//the position of a pitch class within the twelve fifths starting at lowest
+static int getFifths(int pitchClass, int lowest)
 {
-	return keys[name];
+	return lowest + ((pitchClass * 7 - lowest) % 12 + 12) % 12;
 }
 
-String Keys::selectChordName(String keyName, String sharpChordName, String flatChordName)
+//the plain sharp names, F to A#, and the plain flat names, Gb to B
+static constexpr int sharpNames = -1;
+static constexpr int flatNames = -6;
+
+/*
+* Sharp keys lean sharp and flat keys lean flat. They reach one fifth past the plain names for the first accidental of
+* the key (E# or Cb) and two from the second one on (B# or Fb), and further only where the key's own notes need it.
+* Minor keys also reach their leading tone, the major seventh five fifths above the root, so G# in A minor isn't Ab
+*/
+static int getLowestKeyFifths(const Key& key)
 {
-	//TODO, make intelligent
-	return flatChordName;
+	int lowest = key.fifths > 0 ? jmax(sharpNames + jmin(key.fifths, 2), key.fifths - 6) : jmin(flatNames + jmax(key.fifths, -2), key.fifths - 1);
+	if (key.minor)
+		lowest = jmax(lowest, key.getRootFifths() + 5 - 11);
+	return lowest;
 }
 
-static String getNoteName(int midiNote, Key& key, Chord& chord, NoteDrawInfo& noteDrawInfo)
+void Keys::addKey(const String& name, int fifths, bool minor)
 {
-	if (chord.pattern.chordType == Dim)
-	{
-		String curName = MidiMessage::getMidiNoteName(midiNote, true, false, 4);
-		if (curName == chord.rootNote)
-			//root names are sharp if accented
-			return curName;
-		else
-			//other notes are flat (except in two specially handled cases)
-			return MidiMessage::getMidiNoteName(midiNote, false, false, 4);
-	}
+	//the fifths of each natural letter from C to B
+	static const int naturalFifths[] = { 0, 2, 4, -1, 1, 3, 5 };
 
-	String noteName = MidiMessage::getMidiNoteName(midiNote, key.numSharps > 0, false, 4);
-	if ((key.numSharps > 0 && noteName == "F") || (key.numSharps > 1 && noteName == "C"))
-	{
-		noteDrawInfo.anchorNote = midiNote - 1;
-		if (noteName == "F")
-		{
-			noteName = "E#";
-			if (key.numSharps < 6)  //F# has 6, including E#
-				noteDrawInfo.sharp = true;
-		}
-		else if (noteName == "C")
-		{
-			noteName = "B#";
-			if (key.numSharps < 7) //C# has 7, including B#
-				noteDrawInfo.sharp = true;
-		}
-	}
-	else if ((key.numFlats > 0 && noteName == "B") || (key.numFlats > 1 && noteName == "E"))
+	Key& key = keys[numAddedKeys];
+	key.name = name;
+	key.fifths = fifths;
+	key.minor = minor;
+	for (int letter = 0; letter < 7; letter++)
 	{
-		//Bb is the first flat, and Eb the second one. We should not see E or B natural outside of these cases, thus this flattening
-		noteDrawInfo.anchorNote = midiNote + 1;
-		noteDrawInfo.flat = true;
-		if (noteName == "B")
-			noteName = "Cb";
-		else if (noteName == "E")
-			noteName = "Fb";
+		//the seven notes of the key are the fifths from one below the major key's root to five above it
+		int noteFifths = naturalFifths[letter] + 7 * floorDiv(fifths + 5 - naturalFifths[letter], 7);
+		key.alterations[letter] = (int8)getAlteration(noteFifths);
+		key.pitchClasses |= (uint16)(1 << ((noteFifths * 7 % 12 + 12) % 12));
 	}
-	return noteName;
+	key.numSharps = jmax(fifths, 0);
+	key.numFlats = jmax(-fifths, 0);
+	key.index = numAddedKeys++;
 }
 
-void Keys::applyDimAnchorNoteAndAccents(int midiNote, String& noteName, Key& key, Chord& chord, NoteDrawInfo& noteDrawInfo)
+int Keys::getKeyIndex(const String& name) const
 {
-	//special handling here - all accented notes except the root note will be flat
-	if (noteName == chord.rootNote && noteName.length() == 2)
+	for (int idx = 0; idx < numAddedKeys; idx++)
 	{
-		noteDrawInfo.anchorNote = midiNote - 1;
-		if (!key.hasNote(noteName))
-			noteDrawInfo.sharp = true;
-	}
-	else
-	{
-		if (noteName.length() == 2 && noteName != "E#" && noteName != "B#")
-		{
-			//we don't care if the previous algorithm decided sharp or flat - it's always flat when not the root note
-			//except in two cases :)
-			if ((chord.rootNote == "D#" && (noteName == "F#" || noteName == "Gb")) ||
-				(chord.rootNote == "A#" && (noteName == "C#" || noteName == "Db")))
-			{
-				noteDrawInfo.anchorNote = midiNote - 1;
-				if (chord.rootNote == "D#")
-					noteName = "F#";
-				else if (chord.rootNote == "A#")
-					noteName = "C#";
-				if (!key.hasNote(noteName))
-					noteDrawInfo.sharp = true;
-			}
-			else
-			{
-				noteDrawInfo.anchorNote = midiNote + 1;
-				if (!key.hasNote(noteName))
-					noteDrawInfo.flat = true;
-				else
-				{
-					noteDrawInfo.flat = false;
-				}
-			}
-		}
-		else if ((noteName == "D" && chord.rootNote == "F") || (noteName == "A" && chord.rootNote == "C"))
-		{
-			//two very special cases have a double flat
-			noteDrawInfo.anchorNote = midiNote + 2;
-			noteDrawInfo.doubleFlat = true;
-		}
-		else if ((noteName == "B" && chord.rootNote == "F") || (noteName == "B" && chord.rootNote == "D") || (noteName == "E" && chord.rootNote == "G"))
-		{
-			noteDrawInfo.anchorNote = midiNote + 1;
-			noteDrawInfo.flat = true;
-		}
-		else
-		{
-			applyAnchorNoteAndAccentsUsingChordKey(midiNote, key, chord, noteDrawInfo);
-		}
+		if (keys[idx].name == name)
+			return idx;
 	}
+	return -1;
 }
 
-void Keys::applyAnchorNoteAndAccents(int midiNote, Key& key, Chord& chord, NoteDrawInfo& noteDrawInfo)
+std::vector<String> Keys::getKeyNames() const
 {
-	String noteName = getNoteName(midiNote, key, chord, noteDrawInfo);
-	if ((noteName == "G" && chord.rootNote == "G#") || (noteName == "D" && chord.rootNote == "D#") || (noteName == "A" && chord.rootNote == "A#"))
-	{
-		//special double sharp cases
-		noteDrawInfo.anchorNote = midiNote - 2;
-		noteDrawInfo.doubleSharp = true;
-		return;
-	}
+	std::vector<String> keyNames;
+	for (int idx = 0; idx < numAddedKeys; idx++)
+		keyNames.push_back(keys[idx].name);
+	return keyNames;
+}
 
-	if (chord.pattern.chordType == Dim)
+std::vector<int> Keys::getMenuOrder() const
+{
+	std::vector<int> majors, minors, others;
+	for (int idx = 0; idx < numAddedKeys; idx++)
 	{
-		applyDimAnchorNoteAndAccents(midiNote, noteName, key, chord, noteDrawInfo);
-		return;
+		const Key& key = keys[idx];
+		if (key.name == Key::SHARPS || key.name == Key::FLATS)
+			others.push_back(idx);
+		else
+			(key.minor ? minors : majors).push_back(idx);
 	}
 
-	if (chord.isFlat5(midiNote) || chord.isFlat9(midiNote) || chord.isFlat11(midiNote) || chord.isFlat13(midiNote))
+	//by the pitch class of the root, the sharp name before the flat one
+	auto byRoot = [this](int left, int right)
 	{
-		if (noteName == "B#")
-			noteName = "C";
-		else if (noteName == "E#")
-			noteName = "F";
+		int leftRoot = keys[left].getRootFifths(), rightRoot = keys[right].getRootFifths();
+		int leftPitchClass = (leftRoot * 7 % 12 + 12) % 12, rightPitchClass = (rightRoot * 7 % 12 + 12) % 12;
+		return leftPitchClass != rightPitchClass ? leftPitchClass < rightPitchClass : leftRoot > rightRoot;
+	};
+	std::sort(majors.begin(), majors.end(), byRoot);
+	std::sort(minors.begin(), minors.end(), byRoot);
+
+	std::vector<int> order(majors);
+	order.push_back(-1);
+	order.insert(order.end(), minors.begin(), minors.end());
+	order.push_back(-1);
+	order.insert(order.end(), others.begin(), others.end());
+	return order;
+}
 
-		//we want all of them flat or natural
-		if (noteName.length() == 2)
-		{
-			noteName = MidiMessage::getMidiNoteName(midiNote, false, false, 4);
-			noteDrawInfo.anchorNote = midiNote + 1;
-			if (!key.hasNote(noteName))
-			{
-				noteDrawInfo.flat = true;
-			}			
-		}
-		else
-		{
-			noteDrawInfo.anchorNote = midiNote;
-			if (!key.hasNote(noteName))
-			{
-				noteDrawInfo.natural = true;
-				noteDrawInfo.sharp = false;//it's set to true in the E# and B# cases
-			}
-		}
-		return;
-	}
+const Key& Keys::getKey(int keyId) const
+{
+	return keyId >= 0 && keyId < numAddedKeys ? keys[keyId] : noKey;
+}
 
-	if (chord.isSharp5(midiNote) || chord.isSharp9(midiNote) || chord.isSharp11(midiNote))
-	{
-		if (noteName == "Cb")
-			noteName = "B";
-		else if (noteName == "Fb")
-			noteName = "E";
+String Keys::selectChordName(String keyName, String sharpChordName, String flatChordName)
+{
+	//TODO, make intelligent
+	return flatChordName;
+}
 
-		//we want all of them sharp or natural
-		if (noteName.length() == 2)
-		{
-			noteName = MidiMessage::getMidiNoteName(midiNote, true, false, 4);
-			noteDrawInfo.anchorNote = midiNote - 1;
-			if (!key.hasNote(noteName))
-			{
-				noteDrawInfo.sharp = true;
-			}
-		}
-		else
+//everything the spelling of a note depends on, apart from the note itself
+struct SpellingContext
+{
+	const Key* key = nullptr; //null for a key we don't know, where every note gets an accidental
+	int keyNames = flatNames;
+	int chordKind = 0;
+	int rootPitchClass = -1;
+	int rootFifths = 0;
+	bool superPower = false;
+	int chordKeyNames = flatNames; //the plain names of the chord's own major key
+	int interval = 0;
+};
+
+enum { otherChord, major3rdChord, minorChord, dimChord, numChordKinds };
+enum { noInterval, flatInterval, sharpInterval, numIntervals };
+//no root, then natural and flat roots by pitch class, then the sharp roots
+static constexpr int numRoots = 18;
+static constexpr int numPitchClasses = 12;
+
+static int getRootIndex(int rootNote, bool rootSharp)
+{
+	static const int sharpRoots[] = { -1, 13, -1, 14, -1, -1, 15, -1, 16, -1, 17, -1 };
+	if (rootNote < 0)
+		return 0;
+	return rootSharp && isAccentedPitchClass(rootNote) ? sharpRoots[rootNote] : rootNote + 1;
+}
+
+static int spellFifths(int pitchClass, const SpellingContext& context)
+{
+	if (context.rootPitchClass >= 0)
+	{
+		int interval = (pitchClass - context.rootPitchClass + 12) % 12;
+		if (interval == 0)
+			return context.rootFifths;
+		//a semitone below a sharp root or the root of a minor chord is its major seventh, even when that takes a double sharp
+		if (interval == 11 && (context.rootFifths > 5 || context.chordKind == minorChord))
+			return context.rootFifths + 5;
+		if (context.chordKind == dimChord)
 		{
-			noteDrawInfo.anchorNote = midiNote;
-			if (!key.hasNote(noteName))
-			{
-				noteDrawInfo.natural = true;
-				noteDrawInfo.flat = false;//it's set to true in the Cb and Fb cases
-			}
+			//minor third, diminished fifth and diminished seventh, the rest are flat or natural
+			if (interval == 3 || interval == 6 || interval == 9)
+				return context.rootFifths - interval;
+			return getFifths(pitchClass, flatNames);
 		}
-		return;
 	}
 
-	if (Chords::chordHasSuperPower(chord))
-	{
-		applyAnchorNoteAndAccentsUsingChordKey(midiNote, key, chord, noteDrawInfo);
-		return;
-	}
+	//flat intervals are flat or natural and sharp intervals sharp or natural, otherwise spelled the way the key has them
+	int fifths = getFifths(pitchClass, context.keyNames);
+	if (context.interval == flatInterval && getAlteration(fifths) > 0)
+		return getFifths(pitchClass, flatNames);
+	if (context.interval == sharpInterval && getAlteration(fifths) < 0)
+		return getFifths(pitchClass, sharpNames);
+	if (context.interval == noInterval && context.superPower)
+		return getFifths(pitchClass, context.chordKeyNames);
+	return fifths;
+}
 
-	//E#, B#, Cb and Fb get special treatment in getNoteName because they don't end up on the original natural place
-	if (noteName == "E#" || noteName == "B#" || noteName == "Cb" || noteName == "Fb")
-		return;
+void Keys::buildSpellingTable()
+{
+	//the last row is for a key we don't know, which has no notes
+	int numRows = numAddedKeys + 1;
+	spellingTable.assign((size_t)(numRows * numChordKinds * numRoots * numIntervals * numPitchClasses), 0);
 
+	//a chord of each kind, with the chord type that decides it
+	static const ChordType chordKindTypes[] = { None, Major, Minor, Dim };
+	//double flat, flat, natural, sharp and double sharp
+	static const int accidentalBits[] = { 1 << 7, 1 << 4, 1 << 5, 1 << 3, 1 << 6 };
 
-	//Change anchor note if we have sharp or flat
-	if (noteName.length() == 2)
+	for (int keyIndex = 0; keyIndex < numRows; keyIndex++)
 	{
-		bool applyAccent = !key.hasNote(noteName);
-		if (noteName.containsChar('#'))
+		SpellingContext context;
+		if (keyIndex < numAddedKeys)
 		{
-			noteDrawInfo.anchorNote = midiNote - 1;
-			if (applyAccent)
-				noteDrawInfo.sharp = true;
+			context.key = &keys[keyIndex];
+			context.keyNames = getLowestKeyFifths(keys[keyIndex]);
 		}
-		else if (noteName.containsChar('b'))
+
+		for (int chordKind = 0; chordKind < numChordKinds; chordKind++)
 		{
-			noteDrawInfo.anchorNote = midiNote + 1;
-			if (applyAccent)
-				noteDrawInfo.flat = true;
+			for (int rootNote = -1; rootNote < 12; rootNote++)
+			{
+				for (bool rootSharp : { false, true })
+				{
+					if (rootSharp && !isAccentedPitchClass(rootNote))
+						continue;
+
+					Chord chord;
+					chord.chordType = chordKindTypes[chordKind];
+					chord.rootNote = (int8)rootNote;
+					chord.rootSharp = rootSharp;
+					context.chordKind = chordKind;
+					context.rootPitchClass = rootNote;
+					context.rootFifths = getFifths(rootNote, rootSharp ? sharpNames : flatNames);
+					context.superPower = rootNote >= 0 && Chords::chordHasSuperPower(chord);
+					//a minor chord's key is the relative major, three fifths down
+					int chordKeyFifths = chord.chordType == Minor ? context.rootFifths - 3 : context.rootFifths;
+					context.chordKeyNames = chordKeyFifths > 0 ? sharpNames : flatNames;
+
+					for (int interval = 0; interval < numIntervals; interval++)
+					{
+						context.interval = interval;
+						for (int pitchClass = 0; pitchClass < numPitchClasses; pitchClass++)
+						{
+							int fifths = spellFifths(pitchClass, context);
+							int alteration = getAlteration(fifths);
+							//the anchor is the natural note of the letter, and the accidental is only drawn when the key spells the letter differently
+							bool inKey = context.key != nullptr && context.key->alterations[getLetter(fifths)] == alteration;
+							spellingTable[(size_t)getSpellingIndex(keyIndex, chordKind, getRootIndex(rootNote, rootSharp), interval, pitchClass)] =
+								(uint8)((2 - alteration) | (inKey ? 0 : accidentalBits[alteration + 2]));
+						}
+					}
+				}
+			}
 		}
 	}
-	else
-		noteDrawInfo.anchorNote = midiNote;
-
-	if (noteName.length() == 1 && !key.hasNote(noteName))
-		noteDrawInfo.natural = true;
 }
 
-static std::map<String, String> minorToMajor = {
-	{ "C", "Eb" },
-	{ "D", "F" },
-	{ "E", "G" },
-	{ "G", "Bb" },
-	{ "A", "C" },
-	{ "B", "D" }
-};
-
-void Keys::applyAnchorNoteAndAccentsUsingChordKey(int midiNote, Key& key, Chord& chord, NoteDrawInfo& noteDrawInfo)
+int Keys::getSpellingIndex(int keyIndex, int chordKind, int rootIndex, int interval, int pitchClass)
 {
-	Key chordKey = chord.isMajor3rd() ? getKey(chord.rootNote) : getKey(minorToMajor[chord.rootNote]);
-	String noteName = MidiMessage::getMidiNoteName(midiNote, chordKey.numSharps > 0, false, 4);
-	if (noteName.length() == 1)
-	{
-		noteDrawInfo.anchorNote = midiNote;
-		if (!key.hasNote(noteName))
-		{
-			noteDrawInfo.natural = true;
-			noteDrawInfo.sharp = false;
-			noteDrawInfo.flat = false;
-		}
-	}
-	else if (noteName.endsWithChar('#'))
-	{
-		noteDrawInfo.anchorNote = midiNote - 1;
-		if (!key.hasNote(noteName))
-			noteDrawInfo.sharp = true;
-	}
-	else if (noteName.endsWithChar('b'))
-	{
-		noteDrawInfo.anchorNote = midiNote + 1;
-		if (!key.hasNote(noteName))
-			noteDrawInfo.flat = true;
-	}
+	return (((keyIndex * numChordKinds + chordKind) * numRoots + rootIndex) * numIntervals + interval) * numPitchClasses + pitchClass;
+}
 
-}
\ No newline at end of file
+void Keys::applyAnchorNoteAndAccents(int midiNote, const Key& key, const Chord& chord, NoteDrawInfo& noteDrawInfo) const
+{
+	int keyIndex = key.index >= 0 ? key.index : numAddedKeys;
+	int chordKind = chord.chordType == Dim ? dimChord : (chord.chordType == Minor ? minorChord : (chord.isMajor3rd() ? major3rdChord : otherChord));
+	int interval = noInterval;
+	if (chord.isFlat5(midiNote) || chord.isFlat9(midiNote) || chord.isFlat11(midiNote) || chord.isFlat13(midiNote))
+		interval = flatInterval;
+	else if (chord.isSharp5(midiNote) || chord.isSharp9(midiNote) || chord.isSharp11(midiNote))
+		interval = sharpInterval;
+
+	uint8 spelling = spellingTable[(size_t)getSpellingIndex(keyIndex, chordKind, getRootIndex(chord.rootNote, chord.rootSharp), interval, midiNote % 12)];
+	noteDrawInfo.anchorNote = midiNote + (spelling & 7) - 2;
+	noteDrawInfo.sharp = (spelling >> 3) & 1;
+	noteDrawInfo.flat = (spelling >> 4) & 1;
+	noteDrawInfo.natural = (spelling >> 5) & 1;
+	noteDrawInfo.doubleSharp = (spelling >> 6) & 1;
+	noteDrawInfo.doubleFlat = (spelling >> 7) & 1;
+}
@@ -0,0 +1,508 @@
+/*
+  ==============================================================================
+
+   This file is part of the GrandStaffMIDIVisualizer plugin code.
+   Copyright (c) Brynjar Reynisson
+
+   The code included in this file is provided under the terms of the ISC license
+   http://www.isc.org/downloads/software-support-policy/isc-license. Permission
+   to use, copy, modify, and/or distribute this software for any purpose with or
+   without fee is hereby granted provided that the above copyright notice and
+   this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+   REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+   AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+   INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+   LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+   OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+   PERFORMANCE OF THIS SOFTWARE.
+
+  ==============================================================================
+*/
+
+#include "MainComponent.h"
+
+#if JUCE_UNIT_TESTS
+
+/*
+* The string based spelling Keys used before the spelling table, kept here only to compare against.
+* It knows the sixteen keys that existed then, by their note names.
+*/
+struct ReferenceKey
+{
+    std::list<String> notes;
+    int numSharps = 0;
+    int numFlats = 0;
+
+    bool hasNote(const String& noteName) const
+    {
+        return std::find(notes.begin(), notes.end(), noteName) != notes.end();
+    }
+};
+
+static const std::map<String, ReferenceKey>& getReferenceKeys()
+{
+    static const std::map<String, ReferenceKey> referenceKeys = {
+        { "C", { { "C","D","E","F","G","A","B" }, 0, 0 } },
+        { "C#", { { "C#","D#","E#","F#","G#","A#","B#" }, 7, 0 } },
+        { "Db", { { "Db","Eb","F", "Gb","Ab","Bb","C" }, 0, 5 } },
+        { "D", { { "D","E","F#","G","A","B","C#" }, 2, 0 } },
+        { "Eb", { { "Eb","F", "G","Ab","Bb","C","D" }, 0, 3 } },
+        { "E", { { "E","F#","G#","A","B","C#","D#" }, 4, 0 } },
+        { "F", { { "F","G","A","Bb","C","D","E" }, 0, 1 } },
+        { "F#", { { "F#","G#","A#","B","C#","D#","E#" }, 6, 0 } },
+        { "Gb", { { "Gb","Ab","Bb","Cb","Db","Eb","F" }, 0, 6 } },
+        { "G", { { "G","A","B","C","D","E","F#" }, 1, 0 } },
+        { "Ab", { { "Ab","Bb","C","Db","Eb","F","G" }, 0, 4 } },
+        { "A", { { "A","B","C#","D","E","F#","G#" }, 3, 0 } },
+        { "Bb", { { "Bb","C","D","Eb","F","G","A" }, 0, 2 } },
+        { "B", { { "B","C#","D#","E","F#","G#","A#" }, 5, 0 } },
+        { "Sharps", { { "C","D","E","F","G","A","B" }, 0, 0 } },
+        { "Flats", { { "C","D","E","F","G","A","B" }, 0, 0 } }
+    };
+    return referenceKeys;
+}
+
+//a key that isn't there has no notes and no accidentals, like the default Key the old std::map handed out
+static ReferenceKey getReferenceKey(const String& name)
+{
+    auto found = getReferenceKeys().find(name);
+    return found != getReferenceKeys().end() ? found->second : ReferenceKey();
+}
+
+static void referenceUsingChordKey(int midiNote, const ReferenceKey& key, const Chord& chord, NoteDrawInfo& noteDrawInfo)
+{
+    static const std::map<String, String> minorToMajor = {
+        { "C", "Eb" }, { "D", "F" }, { "E", "G" }, { "G", "Bb" }, { "A", "C" }, { "B", "D" }
+    };
+    String majorRoot;
+    if (chord.isMajor3rd())
+        majorRoot = chord.getRootName();
+    else if (minorToMajor.find(chord.getRootName()) != minorToMajor.end())
+        majorRoot = minorToMajor.at(chord.getRootName());
+    ReferenceKey chordKey = getReferenceKey(majorRoot);
+
+    String noteName = MidiMessage::getMidiNoteName(midiNote, chordKey.numSharps > 0, false, 4);
+    if (noteName.length() == 1)
+    {
+        noteDrawInfo.anchorNote = midiNote;
+        if (!key.hasNote(noteName))
+        {
+            noteDrawInfo.natural = true;
+            noteDrawInfo.sharp = false;
+            noteDrawInfo.flat = false;
+        }
+    }
+    else if (noteName.endsWithChar('#'))
+    {
+        noteDrawInfo.anchorNote = midiNote - 1;
+        if (!key.hasNote(noteName))
+            noteDrawInfo.sharp = true;
+    }
+    else if (noteName.endsWithChar('b'))
+    {
+        noteDrawInfo.anchorNote = midiNote + 1;
+        if (!key.hasNote(noteName))
+            noteDrawInfo.flat = true;
+    }
+}
+
+static String referenceGetNoteName(int midiNote, const ReferenceKey& key, const Chord& chord, NoteDrawInfo& noteDrawInfo)
+{
+    if (chord.chordType == Dim)
+    {
+        String curName = MidiMessage::getMidiNoteName(midiNote, true, false, 4);
+        if (curName == chord.getRootName())
+            return curName;
+        else
+            return MidiMessage::getMidiNoteName(midiNote, false, false, 4);
+    }
+
+    String noteName = MidiMessage::getMidiNoteName(midiNote, key.numSharps > 0, false, 4);
+    if ((key.numSharps > 0 && noteName == "F") || (key.numSharps > 1 && noteName == "C"))
+    {
+        noteDrawInfo.anchorNote = midiNote - 1;
+        if (noteName == "F")
+        {
+            noteName = "E#";
+            if (key.numSharps < 6)
+                noteDrawInfo.sharp = true;
+        }
+        else if (noteName == "C")
+        {
+            noteName = "B#";
+            if (key.numSharps < 7)
+                noteDrawInfo.sharp = true;
+        }
+    }
+    else if ((key.numFlats > 0 && noteName == "B") || (key.numFlats > 1 && noteName == "E"))
+    {
+        noteDrawInfo.anchorNote = midiNote + 1;
+        noteDrawInfo.flat = true;
+        if (noteName == "B")
+            noteName = "Cb";
+        else if (noteName == "E")
+            noteName = "Fb";
+    }
+    return noteName;
+}
+
+static void referenceDim(int midiNote, String& noteName, const ReferenceKey& key, const Chord& chord, NoteDrawInfo& noteDrawInfo)
+{
+    if (noteName == chord.getRootName() && noteName.length() == 2)
+    {
+        noteDrawInfo.anchorNote = midiNote - 1;
+        if (!key.hasNote(noteName))
+            noteDrawInfo.sharp = true;
+    }
+    else
+    {
+        if (noteName.length() == 2 && noteName != "E#" && noteName != "B#")
+        {
+            if ((chord.getRootName() == "D#" && (noteName == "F#" || noteName == "Gb")) ||
+                (chord.getRootName() == "A#" && (noteName == "C#" || noteName == "Db")))
+            {
+                noteDrawInfo.anchorNote = midiNote - 1;
+                if (chord.getRootName() == "D#")
+                    noteName = "F#";
+                else if (chord.getRootName() == "A#")
+                    noteName = "C#";
+                if (!key.hasNote(noteName))
+                    noteDrawInfo.sharp = true;
+            }
+            else
+            {
+                noteDrawInfo.anchorNote = midiNote + 1;
+                if (!key.hasNote(noteName))
+                    noteDrawInfo.flat = true;
+                else
+                    noteDrawInfo.flat = false;
+            }
+        }
+        else if ((noteName == "D" && chord.getRootName() == "F") || (noteName == "A" && chord.getRootName() == "C"))
+        {
+            noteDrawInfo.anchorNote = midiNote + 2;
+            noteDrawInfo.doubleFlat = true;
+        }
+        else if ((noteName == "B" && chord.getRootName() == "F") || (noteName == "B" && chord.getRootName() == "D") || (noteName == "E" && chord.getRootName() == "G"))
+        {
+            noteDrawInfo.anchorNote = midiNote + 1;
+            noteDrawInfo.flat = true;
+        }
+        else
+        {
+            referenceUsingChordKey(midiNote, key, chord, noteDrawInfo);
+        }
+    }
+}
+
+static void referenceApplyAnchorNoteAndAccents(int midiNote, const ReferenceKey& key, const Chord& chord, NoteDrawInfo& noteDrawInfo)
+{
+    String noteName = referenceGetNoteName(midiNote, key, chord, noteDrawInfo);
+    if ((noteName == "G" && chord.getRootName() == "G#") || (noteName == "D" && chord.getRootName() == "D#") || (noteName == "A" && chord.getRootName() == "A#"))
+    {
+        noteDrawInfo.anchorNote = midiNote - 2;
+        noteDrawInfo.doubleSharp = true;
+        return;
+    }
+
+    if (chord.chordType == Dim)
+    {
+        referenceDim(midiNote, noteName, key, chord, noteDrawInfo);
+        return;
+    }
+
+    if (chord.isFlat5(midiNote) || chord.isFlat9(midiNote) || chord.isFlat11(midiNote) || chord.isFlat13(midiNote))
+    {
+        if (noteName == "B#")
+            noteName = "C";
+        else if (noteName == "E#")
+            noteName = "F";
+
+        if (noteName.length() == 2)
+        {
+            noteName = MidiMessage::getMidiNoteName(midiNote, false, false, 4);
+            noteDrawInfo.anchorNote = midiNote + 1;
+            if (!key.hasNote(noteName))
+                noteDrawInfo.flat = true;
+        }
+        else
+        {
+            noteDrawInfo.anchorNote = midiNote;
+            if (!key.hasNote(noteName))
+            {
+                noteDrawInfo.natural = true;
+                noteDrawInfo.sharp = false;
+            }
+        }
+        return;
+    }
+
+    if (chord.isSharp5(midiNote) || chord.isSharp9(midiNote) || chord.isSharp11(midiNote))
+    {
+        if (noteName == "Cb")
+            noteName = "B";
+        else if (noteName == "Fb")
+            noteName = "E";
+
+        if (noteName.length() == 2)
+        {
+            noteName = MidiMessage::getMidiNoteName(midiNote, true, false, 4);
+            noteDrawInfo.anchorNote = midiNote - 1;
+            if (!key.hasNote(noteName))
+                noteDrawInfo.sharp = true;
+        }
+        else
+        {
+            noteDrawInfo.anchorNote = midiNote;
+            if (!key.hasNote(noteName))
+            {
+                noteDrawInfo.natural = true;
+                noteDrawInfo.flat = false;
+            }
+        }
+        return;
+    }
+
+    if (Chords::chordHasSuperPower(chord))
+    {
+        referenceUsingChordKey(midiNote, key, chord, noteDrawInfo);
+        return;
+    }
+
+    if (noteName == "E#" || noteName == "B#" || noteName == "Cb" || noteName == "Fb")
+        return;
+
+    if (noteName.length() == 2)
+    {
+        bool applyAccent = !key.hasNote(noteName);
+        if (noteName.containsChar('#'))
+        {
+            noteDrawInfo.anchorNote = midiNote - 1;
+            if (applyAccent)
+                noteDrawInfo.sharp = true;
+        }
+        else if (noteName.containsChar('b'))
+        {
+            noteDrawInfo.anchorNote = midiNote + 1;
+            if (applyAccent)
+                noteDrawInfo.flat = true;
+        }
+    }
+    else
+        noteDrawInfo.anchorNote = midiNote;
+
+    if (noteName.length() == 1 && !key.hasNote(noteName))
+        noteDrawInfo.natural = true;
+}
+
+/*
+* Compares the spelling table with the string logic for every chord Chords::getChord can find: the null chord or any
+* pattern on any root, spelled sharp only where the root is accented. Spelling only looks at the pitch class, so one
+* octave of notes covers the whole midi range.
+*/
+class KeysTests final : public UnitTest
+{
+public:
+    KeysTests() : UnitTest("Keys", "GrandStaffMIDIVisualizer") {}
+
+    void runTest() override
+    {
+        Keys keys;
+        Key unknownKey;
+        std::vector<Chord> chords = getChords();
+
+        beginTest("The spelling table matches the string logic apart from the rules the line of fifths changed");
+        int numCompared = 0;
+        int numChanged = 0;
+        int numDifferent = 0;
+        for (int keyId = -1; keyId < Keys::numKeys; keyId++)
+        {
+            const Key& key = keyId < 0 ? unknownKey : keys.getKey(keyId);
+            auto referenceKey = getReferenceKeys().find(key.name);
+            if (keyId >= 0 && referenceKey == getReferenceKeys().end())
+                continue;
+
+            for (const Chord& chord : chords)
+            {
+                for (int midiNote = 60; midiNote < 72; midiNote++)
+                {
+                    if (isChangedOnPurpose(key, chord, midiNote % 12))
+                    {
+                        numChanged++;
+                        continue;
+                    }
+
+                    NoteDrawInfo expected, actual;
+                    referenceApplyAnchorNoteAndAccents(midiNote, keyId < 0 ? ReferenceKey() : referenceKey->second, chord, expected);
+                    keys.applyAnchorNoteAndAccents(midiNote, key, chord, actual);
+                    numCompared++;
+                    if (getSpelling(expected, midiNote) != getSpelling(actual, midiNote))
+                    {
+                        if (numDifferent++ < numLoggedDifferences)
+                            logMessage("differs: key " + (keyId < 0 ? String("unknown") : key.name) + ", chord " + chord.name() + ", note " + String(midiNote % 12));
+                    }
+                }
+            }
+        }
+        logMessage(String(numCompared) + " spellings compared, " + String(numChanged) + " left out where a rule changed on purpose");
+        expectEquals(numDifferent, 0, "spellings that differ from the string logic");
+
+        beginTest("Theoretical keys spell their double sharps");
+        expectEquals(spell(keys, "G#", nullChord, 7), String("F##"));
+        expectEquals(spell(keys, "D#", nullChord, 7), String("F##"));
+        expectEquals(spell(keys, "D#", nullChord, 2), String("C##"));
+        expectEquals(spell(keys, "A#", nullChord, 7), String("F##"));
+        expectEquals(spell(keys, "A#", nullChord, 2), String("C##"));
+        expectEquals(spell(keys, "A#", nullChord, 9), String("G##"));
+
+        beginTest("Key signatures past seven sharps draw the first ones as double sharps");
+        expectEquals(getSignature(keys, "C#"), String("#######"));
+        expectEquals(getSignature(keys, "G#"), String("x######"));
+        expectEquals(getSignature(keys, "D#"), String("xx#####"));
+        expectEquals(getSignature(keys, "A#"), String("xxx####"));
+
+        beginTest("Minor keys spell their leading tone");
+        const char* leadingTones[][2] = {
+            { "Cm", "B (n)" }, { "C#m", "B# (#)" }, { "Dm", "C# (#)" }, { "D#m", "C## (x)" }, { "Ebm", "D (n)" },
+            { "Em", "D# (#)" }, { "Fm", "E (n)" }, { "F#m", "E# (#)" }, { "Gm", "F# (#)" }, { "G#m", "F## (x)" },
+            { "Abm", "G (n)" }, { "Am", "G# (#)" }, { "A#m", "G## (x)" }, { "Bbm", "A (n)" }, { "Bm", "A# (#)" }
+        };
+        for (auto& leadingTone : leadingTones)
+        {
+            const Key& key = keys.getKey(keys.getKeyIndex(leadingTone[0]));
+            int rootPitchClass = (key.getRootFifths() * 7 % 12 + 12) % 12;
+            expectEquals(spell(keys, leadingTone[0], nullChord, (rootPitchClass + 11) % 12), String(leadingTone[1]), leadingTone[0]);
+        }
+        //chords that spell notes their own way too
+        expectEquals(spell(keys, "Am", getChord("m(M7)", 9, false), 8), String("G# (#)"));
+        expectEquals(spell(keys, "C", getChord("m", 2, false), 1), String("C# (#)"));
+
+        beginTest("A chord's root is spelled the way the chord is named");
+        expectEquals(spell(keys, "C#", getChord("m", 5, false), 5), String("F (n)"));
+        expectEquals(spell(keys, "C", getChord("", 1, true), 1), String("C# (#)"));
+        expectEquals(spell(keys, "C", getChord("", 1, false), 1), String("Db (b)"));
+
+        beginTest("A major seventh above a sharp root is spelled as one");
+        expectEquals(spell(keys, "C", getChord("M7", 1, true), 0), String("B# (#)"));
+        expectEquals(spell(keys, "C", getChord("M7", 3, true), 2), String("C## (x)"));
+
+        beginTest("Notes in the key signature don't get an accidental");
+        expectEquals(spell(keys, "Gb", nullChord, 11), String("Cb"));
+        expectEquals(spell(keys, "C#", nullChord, 5), String("E#"));
+        expectEquals(spell(keys, "C#", nullChord, 0), String("B#"));
+    }
+
+private:
+    static constexpr int numLoggedDifferences = 10;
+
+    //the rules the line of fifths changed on purpose
+    static bool isChangedOnPurpose(const Key& key, const Chord& chord, int pitchClass)
+    {
+        int interval = (pitchClass - chord.rootNote + 12) % 12;
+        if (chord.rootNote >= 0)
+        {
+            //the root is spelled the way the chord is named, F in an Fm chord in C# rather than E#
+            if (interval == 0)
+                return true;
+            //a semitone below a sharp root or the root of a minor chord is its major seventh, B# under C# rather than C
+            if (interval == 11 && (chord.rootSharp || chord.chordType == Minor))
+                return true;
+            //dim chords spell the minor third, diminished fifth and diminished seventh from the root, Fb in Dbdim rather than E
+            if (chord.chordType == Dim && (interval == 3 || interval == 6 || interval == 9))
+                return true;
+        }
+
+        //E#, B#, Cb and Fb don't get an accidental in a key that has them
+        static const int letters[] = { 6, -1, -1, -1, 3, 2, -1, -1, -1, -1, -1, 0 };
+        static const int alterations[] = { 1, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, -1 };
+        return letters[pitchClass] >= 0 && key.alterations[letters[pitchClass]] == alterations[pitchClass];
+    }
+
+    static std::vector<Chord> getChords()
+    {
+        std::vector<Chord> chords { nullChord };
+        for (int patternIndex = 0; patternIndex < Chords::getNumPatterns(); patternIndex++)
+        {
+            for (int rootNote = 0; rootNote < 12; rootNote++)
+            {
+                for (bool rootSharp : { false, true })
+                {
+                    //Chords::getChord only spells accented roots sharp
+                    if (rootSharp && !isAccentedPitchClass(rootNote))
+                        continue;
+                    Chord chord;
+                    chord.patternIndex = (int16)patternIndex;
+                    chord.chordType = Chords::getPattern(patternIndex).chordType;
+                    chord.rootNote = (int8)rootNote;
+                    chord.rootSharp = rootSharp;
+                    chords.push_back(chord);
+                }
+            }
+        }
+        return chords;
+    }
+
+    static Chord getChord(const String& patternName, int rootNote, bool rootSharp)
+    {
+        Chord chord;
+        for (int patternIndex = 0; patternIndex < Chords::getNumPatterns(); patternIndex++)
+        {
+            if (Chords::getPatternName(patternIndex, false) == patternName)
+            {
+                chord.patternIndex = (int16)patternIndex;
+                chord.chordType = Chords::getPattern(patternIndex).chordType;
+                chord.rootNote = (int8)rootNote;
+                chord.rootSharp = rootSharp;
+                break;
+            }
+        }
+        return chord;
+    }
+
+    //the name the note is spelled with, followed by the accidental that gets drawn if there is one: F## (x), Cb or B (n)
+    static String spell(const Keys& keys, const String& keyName, const Chord& chord, int pitchClass)
+    {
+        static const char* letters[] = { "C", "", "D", "", "E", "F", "", "G", "", "A", "", "B" };
+        static const char* alterations[] = { "bb", "b", "", "#", "##" };
+
+        NoteDrawInfo noteDrawInfo;
+        int midiNote = 60 + pitchClass;
+        keys.applyAnchorNoteAndAccents(midiNote, keys.getKey(keys.getKeyIndex(keyName)), chord, noteDrawInfo);
+        String name = String(letters[noteDrawInfo.anchorNote % 12]) + alterations[midiNote - noteDrawInfo.anchorNote + 2];
+
+        if (noteDrawInfo.sharp)
+            return name + " (#)";
+        if (noteDrawInfo.flat)
+            return name + " (b)";
+        if (noteDrawInfo.natural)
+            return name + " (n)";
+        if (noteDrawInfo.doubleSharp)
+            return name + " (x)";
+        if (noteDrawInfo.doubleFlat)
+            return name + " (bb)";
+        return name;
+    }
+
+    //the sharps MainComponent::drawSharps draws, x for a double sharp
+    static String getSignature(const Keys& keys, const String& keyName)
+    {
+        const Key& key = keys.getKey(keys.getKeyIndex(keyName));
+        String signature;
+        for (int i = 0; i < jmin(key.numSharps, 7); i++)
+            signature += key.isDoubleSharp(i) ? "x" : "#";
+        return signature;
+    }
+
+    //the anchor relative to the note and the accidentals, in one number
+    static int getSpelling(const NoteDrawInfo& noteDrawInfo, int midiNote)
+    {
+        return ((noteDrawInfo.anchorNote - midiNote) & 0xff) | (noteDrawInfo.sharp ? 1 << 8 : 0) | (noteDrawInfo.flat ? 1 << 9 : 0) |
+            (noteDrawInfo.natural ? 1 << 10 : 0) | (noteDrawInfo.doubleSharp ? 1 << 11 : 0) | (noteDrawInfo.doubleFlat ? 1 << 12 : 0);
+    }
+};
+
+static KeysTests keysTests;
+
+#endif
@@ -25,49 +25,105 @@
 #include <cmath>
 #include <set>
 
-static const Font getCustomFont(bool bold = true)
-{
-    return bold ? boldCustomFont : plainCustomFont;
-}
-
 void MainComponent::onParametersChanged()
 {
-    keyMenu.setSelectedId(pluginModel->keyId + 1, false);
-    holdNoteButton.setToggleState(pluginModel->holdNotes, false);
-    octaveSlider.setValue(pluginModel->transposeOctaves);
-    notationButton.setToggleState(pluginModel->shortNotation, false);
+    //cleared before reading, so a change the host makes while we're in here is picked up next time
+    pluginModel->hasParamChanges = false;
+    settings = pluginModel->getSettings();
+    keyMenu.setSelectedId(settings.keyId + 1, false);
+    invalidateStaffLayer();
+    notationLayoutDirty = true;
+    holdNoteButton.setToggleState(settings.holdNotes, false);
+    octaveSlider.setValue(settings.transposeOctaves);
+    notationButton.setToggleState(settings.shortNotation, false);
     updateChordPlacementButton();
-    chordFontBoldButton.setToggleState(pluginModel->chordFontBold, false);
+    chordFontBoldButton.setToggleState(settings.chordFontBold, false);
     updateColourScheme();
     if (getParentComponent() != nullptr && (pluginModel->uiWidth != getWidth() || pluginModel->uiHeight != getHeight()))
     {
         getParentComponent()->postCommandMessage(CMD_MSG_RESIZE);
+        //again once resized
+        pluginModel->hasParamChanges = true;
         return;
     }
-    pluginModel->hasParamChanges = false;
     repaint();
 }
 
 void MainComponent::onMidiChanged()
 {
-    ScopedLock lock(pluginModel->criticalSection);
+    //until the audio thread has acted on a reset, what it published still has the notes the user just cleared
+    NoteMask noteMask;
+    if (pluginModel->midiNotesResetsHandled.load() == pluginModel->midiNotesResetRequests.load())
+        noteMask = pluginModel->midiNotes.read();
+
+    //replay the events since last time, notes that were released before we got here are still shown for a moment
+    uint32 now = Time::getMillisecondCounter();
+    MidiNoteEvent events[64];
+    int numEvents;
+    while ((numEvents = pluginModel->midiEvents.pop(events, numElementsInArray(events))) > 0)
+    {
+        for (int i = 0; i < numEvents; i++)
+            if (events[i].on && !settings.holdNotes)
+                noteShownUntil[events[i].note] = now + minimumNoteDisplayMs;
+    }
+
+    hasShortNotes = false;
+    for (int i = 0; i < 128; i++)
+    {
+        if (!noteMask.test(i) && (int32)(noteShownUntil[i] - now) > 0)
+        {
+            noteMask.set(i, true);
+            hasShortNotes = true;
+        }
+    }
+    if (noteMask != shownNotes)
+        notationLayoutDirty = true;
+    shownNotes = noteMask;
+
     this->midiNotes.clear();
-    for (int i=0; i<127; i++)
-        if (pluginModel->midiNotes[i])
+    for (int i=0; i<128; i++)
+        if (noteMask.test(i))
             this->midiNotes.insert(i);
 
     chord = nullChord;
-    chords.name(this->midiNotes, keys.getKey(keyMenu.getText()), chord);
-    if (chord.name().length() != 0 && chordFadeOut.isRunning())
+    chords.name(this->midiNotes, keys.getKey(keyMenu.getSelectedId() - 1), chord);
+    if (!chord.isNull() && chordFadeOut.isRunning())
     {
         chordFadeOut.stop();
     }
 }
 
+void MainComponent::onVBlank()
+{
+    uint32 midiChangeCount = pluginModel->midiChangeCount.load();
+    if (midiChangeCount != lastMidiChangeCount)
+    {
+        //any number of blocks may have changed the notes since the last refresh, one update covers them all
+        numCoalescedMidiUpdates += midiChangeCount - lastMidiChangeCount - 1;
+        lastMidiChangeCount = midiChangeCount;
+        onMidiChanged();
+        repaint();
+    }
+    else if (hasShortNotes)
+    {
+        //nothing new from the audio thread, only repaint when a short note has timed out
+        NoteMask previousNotes = shownNotes;
+        onMidiChanged();
+        if (shownNotes != previousNotes)
+            repaint();
+    }
+
+    //the host only flags its changes, they are applied from paint on the message thread
+    if (pluginModel->hasParamChanges.load())
+        repaint();
+}
+
 void MainComponent::init(PluginModel* model)
 {
     this->pluginModel = model;
-    pluginModel->paramChangedFromHost = [&] { onParametersChanged(); };
+    settings = pluginModel->getSettings();
+    pluginModel->midiEvents.discardAll();
+    lastMidiChangeCount = pluginModel->midiChangeCount.load();
     chordFadeOut.onStopped = [&] { onChordFadeOutStopped(); };
 
     lightLookAndFeel.setLightModeLookAndFeel();
@@ -75,13 +131,16 @@ void MainComponent::init(PluginModel* model)
 
     holdNoteButton.addListener(this);
     holdNoteButton.setToggleable(true);
-    holdNoteButton.setToggleState(pluginModel->holdNotes, false);
+    holdNoteButton.setToggleState(settings.holdNotes, false);
     holdNoteButton.setTooltip("Hold notes");
 
-    int i = 1;
-    for (String key : keys.getKeyNames())
+    //menu ids are the key ids plus one, whatever order the menu shows them in
+    for (int keyId : keys.getMenuOrder())
     {
-        keyMenu.addItem(key, i++);
+        if (keyId < 0)
+            keyMenu.addSeparator();
+        else
+            keyMenu.addItem(keys.getKey(keyId).name, keyId + 1);
     }
     keyMenu.setJustificationType(Justification::centred);    
     keyMenu.setSelectedItemIndex(1);
@@ -92,7 +151,7 @@ void MainComponent::init(PluginModel* model)
     notationButton.setButtonText(juce::CharPointer_UTF8("\xe2\x88\x86"));
     notationButton.setTooltip("Short notation");
     notationButton.setToggleable(true);
-    notationButton.setToggleState(pluginModel->shortNotation, false);
+    notationButton.setToggleState(settings.shortNotation, false);
 
     chordPlacementButton.addListener(this);
 
@@ -102,7 +161,7 @@ void MainComponent::init(PluginModel* model)
 
     darkModeButton.addListener(this);
     darkModeButton.setToggleable(true);
-    darkModeButton.setToggleState(pluginModel->darkMode, false);
+    darkModeButton.setToggleState(settings.darkMode, false);
     darkModeButton.setButtonText("D");
     darkModeButton.setTooltip("Dark mode");
 
@@ -111,7 +170,7 @@ void MainComponent::init(PluginModel* model)
     octaveSlider.setRange(-3, 3, 1);
     octaveSlider.setPopupDisplayEnabled(true, true, this);
     octaveSlider.addListener(this);
-    octaveSlider.setValue(pluginModel->transposeOctaves);
+    octaveSlider.setValue(settings.transposeOctaves);
 
     updateColourScheme();
     onParametersChanged();
@@ -123,26 +182,29 @@ void MainComponent::init(PluginModel* model)
     addAndMakeVisible(chordFontBoldButton);
     addAndMakeVisible(darkModeButton);
     addAndMakeVisible(octaveSlider);
+
+    //show whatever is already being played when the editor opens
+    onMidiChanged();
 }
 
 void MainComponent::updateChordPlacementButton()
 {
-    if (pluginModel->chordPlacement == 0)
+    if (settings.chordPlacement == 0)
     {
-        chordPlacementButton.setImages(blankSvg.get());
+        chordPlacementButton.setImages(resources->getBlank());
         chordPlacementButton.setTooltip("Chord name in bottom");
     }
-    else if (pluginModel->chordPlacement == 1)
+    else if (settings.chordPlacement == 1)
     {
         chordPlacementButton.setImages(arrowDownSvg);
         chordPlacementButton.setTooltip("Chord name to the right");
     }
-    else if (pluginModel->chordPlacement == 2)
+    else if (settings.chordPlacement == 2)
     {
         chordPlacementButton.setImages(arrowRightSvg);
         chordPlacementButton.setTooltip("Only chord name");
     }
-    else if (pluginModel->chordPlacement == 3)
+    else if (settings.chordPlacement == 3)
     {
         chordPlacementButton.setImages(arrowUpSvg);
         chordPlacementButton.setTooltip("No chord name");
@@ -151,39 +213,21 @@ void MainComponent::updateChordPlacementButton()
 
 void MainComponent::updateColourScheme()
 {
-    CustomLookAndFeel* lookAndFeel = nullptr;
-    if (pluginModel->darkMode)
-    {
-        lookAndFeel = &darkLookAndFeel;
-        staffSvg = dmStaffSvg.get();
-        noteSvg = dmNoteSvg.get();
-        incrementSvg = dmIncrementSvg.get();
-        arrowDownSvg = dmArrowDownSvg.get();
-        arrowRightSvg = dmArrowRightSvg.get();
-        arrowUpSvg = dmArrowUpSvg.get();
-        sharpSvg = dmSharpSvg.get();        
-        flatSvg = dmFlatSvg.get();
-        naturalSvg = dmNaturalSvg.get();
-        doubleSharpSvg = dmDoubleSharpSvg.get();
-        doubleFlatSvg = dmDoubleFlatSvg.get();
-        darkModeButton.setToggleState(true, false);
-    }
-    else
-    {
-        lookAndFeel = &lightLookAndFeel;
-        staffSvg = lmStaffSvg.get();
-        noteSvg = lmNoteSvg.get();
-        incrementSvg = lmIncrementSvg.get();
-        arrowDownSvg = lmArrowDownSvg.get();
-        arrowRightSvg = lmArrowRightSvg.get();
-        arrowUpSvg = lmArrowUpSvg.get();
-        sharpSvg = lmSharpSvg.get();
-        flatSvg = lmFlatSvg.get();
-        naturalSvg = lmNaturalSvg.get();
-        doubleSharpSvg = lmDoubleSharpSvg.get();
-        doubleFlatSvg = lmDoubleFlatSvg.get();
-        darkModeButton.setToggleState(false, false);
-    }
+    bool darkMode = settings.darkMode;
+    CustomLookAndFeel* lookAndFeel = darkMode ? &darkLookAndFeel : &lightLookAndFeel;
+    staffSvg = resources->getDrawable(SharedResources::staff, darkMode);
+    noteSvg = resources->getDrawable(SharedResources::note, darkMode);
+    incrementSvg = resources->getDrawable(SharedResources::increment, darkMode);
+    arrowDownSvg = resources->getDrawable(SharedResources::arrowDown, darkMode);
+    arrowRightSvg = resources->getDrawable(SharedResources::arrowRight, darkMode);
+    arrowUpSvg = resources->getDrawable(SharedResources::arrowUp, darkMode);
+    sharpSvg = resources->getDrawable(SharedResources::sharp, darkMode);
+    flatSvg = resources->getDrawable(SharedResources::flat, darkMode);
+    doubleSharpSvg = resources->getDrawable(SharedResources::doubleSharp, darkMode);
+    darkModeButton.setToggleState(darkMode, false);
+    glyphAtlas.setDrawables({ noteSvg, sharpSvg, flatSvg, resources->getDrawable(SharedResources::natural, darkMode), doubleSharpSvg,
+        resources->getDrawable(SharedResources::doubleFlat, darkMode) });
+    invalidateStaffLayer();
     keyMenu.setLookAndFeel(lookAndFeel);
     holdNoteButton.setImages(noteSvg);
     updateChordPlacementButton();
@@ -201,6 +245,11 @@ void MainComponent::resized()
     auto bounds = getLocalBounds();
     pluginModel->uiWidth = bounds.getWidth();
     pluginModel->uiHeight = bounds.getHeight();
+    //all staff geometry depends on the bounds only, so this is the one place it needs to be worked out
+    staffCalculator = StaffCalculator(bounds);
+    invalidateStaffLayer();
+    notationLayoutCache.clear();
+    notationLayoutDirty = true;
 
     int buttonSize = getButtonHeight(bounds);
     int buttonSpace = buttonSize * 0.1;
@@ -222,9 +271,11 @@ void MainComponent::resized()
 void MainComponent::sliderValueChanged(Slider* slider)
 {
     int newValue = slider->getValue();
-    if (newValue != pluginModel->transposeOctaves)
+    if (newValue != settings.transposeOctaves)
     {
-        pluginModel->transposeOctaves = newValue;
+        settings.transposeOctaves = (int8)newValue;
+        pluginModel->setSetting(&PluginSettings::transposeOctaves, newValue);
+        notationLayoutDirty = true;
         NullCheckedInvocation::invoke(pluginModel->paramChangedFromUI);
         repaint();
     }
@@ -239,32 +290,41 @@ void MainComponent::buttonClicked(juce::Button* button)
     {
         lastChordName = "";
         this->midiNotes.clear();
+        shownNotes.clear();
+        chord = nullChord;
+        notationLayoutDirty = true;
         bool curMode = holdNoteButton.getToggleState();
         holdNoteButton.setToggleState(!curMode, false);
-        for (int i = 0; i < 127; i++)
-            pluginModel->midiNotes[i] = 0;
-        pluginModel->holdNotes = holdNoteButton.getToggleState();
+        pluginModel->midiNotesResetRequests++;
+        for (uint32& shownUntil : noteShownUntil)
+            shownUntil = 0;
+        settings.holdNotes = holdNoteButton.getToggleState();
+        pluginModel->setSetting(&PluginSettings::holdNotes, settings.holdNotes);
         onMidiChanged();
     }
     else if (button == &notationButton)
     {
-        pluginModel->shortNotation = !pluginModel->shortNotation;
-        notationButton.setToggleState(pluginModel->shortNotation, false);
+        settings.shortNotation = !settings.shortNotation;
+        pluginModel->setSetting(&PluginSettings::shortNotation, settings.shortNotation);
+        notationButton.setToggleState(settings.shortNotation, false);
     }
     else if (button == &chordPlacementButton)
     {
-        pluginModel->chordPlacement = pluginModel->chordPlacement == 3 ? 0 : pluginModel->chordPlacement + 1;
+        settings.chordPlacement = (int8)(settings.chordPlacement == 3 ? 0 : settings.chordPlacement + 1);
+        pluginModel->setSetting(&PluginSettings::chordPlacement, settings.chordPlacement);
         updateChordPlacementButton();
     }
     else if (button == &chordFontBoldButton)
     {
         bool curMode = chordFontBoldButton.getToggleState();
         chordFontBoldButton.setToggleState(!curMode, false);
-        pluginModel->chordFontBold = chordFontBoldButton.getToggleState();
+        settings.chordFontBold = chordFontBoldButton.getToggleState();
+        pluginModel->setSetting(&PluginSettings::chordFontBold, settings.chordFontBold);
     }
     else if (button == &darkModeButton)
     {
-        pluginModel->darkMode = !pluginModel->darkMode;
+        settings.darkMode = !settings.darkMode;
+        pluginModel->setSetting(&PluginSettings::darkMode, settings.darkMode);
         updateColourScheme();
     }
 
@@ -273,94 +333,10 @@ void MainComponent::buttonClicked(juce::Button* button)
 }
 
 
-static int dontMoveRight[] = {
-    17, 21, 24, 28,  //F0 to F1 below F-clef
-    31, 35, 38, 41, 45, //G1 to A2 on F-clef
-    48, 52, 55, 59, 62, //C3 to D4 on G-clef
-    65, 69, 72, 76, 79 //F4 to G5
-};
-
-static std::set<int> conflictLosers = {
-    12, 16, 19, 23, 26, 29,
-    33, 36, 40, 43, 47,
-    50, 53, 57, 60, 64,
-    67, 71, 74, 77, 81
-};
-
-/*
-* When notes are placed close to neighbor notes (e.g. E and F), one or more notes need to move to the right.
-* This method figures out how much to the right notes need to move (three places at most)
-*/
-static void resolveNeighborConflicts(std::set<int>& midiNotes, NoteDrawInfo* noteDrawInfos)
+void MainComponent::drawText(Graphics& g, const String& text, float x, float y, float width, float height, bool left)
 {
-    std::map<int, int> noteCount;
-    for (int midiNote : midiNotes)
-    {
-        /*
-        * Here we mark the note count for each anchorNote (the actual graphical placement of the midi note).
-        * For all double notes, move the second one of them, one place to the right.
-        */
-        NoteDrawInfo& noteDrawInfo = noteDrawInfos[midiNote];
-        if (noteCount.find(noteDrawInfo.anchorNote) != noteCount.end())
-        {
-            noteCount[noteDrawInfo.anchorNote] = 2;
-            noteDrawInfo.moveRight = 1;
-        }
-        else
-        {
-            noteCount[noteDrawInfo.anchorNote] = 1;
-        }
-    }
-    for (int midiNote : midiNotes)
-    {
-        /*
-        * We don't want to move notes that are over a staff line too much to the right,
-        * other notes (conflictLosers) will by default move as much to the right as needed.
-        */
-        NoteDrawInfo& noteDrawInfo = noteDrawInfos[midiNote];
-        int cur = noteDrawInfo.anchorNote;
-        if (conflictLosers.find(cur) != conflictLosers.end())
-        {
-            int belowNeighbor = -1;
-            int aboveNeighbor = -1;
-            if (MidiMessage::getMidiNoteName(cur, true, false, 4) == "E" || MidiMessage::getMidiNoteName(cur, true, false, 4) == "B")
-            {
-                belowNeighbor = cur - 2;
-                aboveNeighbor = cur + 1;
-            }
-            else if (MidiMessage::getMidiNoteName(cur, true, false, 4) == "F" || MidiMessage::getMidiNoteName(cur, true, false, 4) == "C")
-            {
-                belowNeighbor = cur - 1;
-                aboveNeighbor = cur + 2;
-            }
-            else
-            {
-                belowNeighbor = cur - 2;
-                aboveNeighbor = cur + 2;
-            }
-            int neighborCount = 0;
-            if (noteCount.find(belowNeighbor) != noteCount.end())
-            {
-                neighborCount = noteCount[belowNeighbor];
-            }
-            if (noteCount.find(aboveNeighbor) != noteCount.end())
-            {
-                neighborCount = noteCount[aboveNeighbor] > neighborCount ? noteCount[aboveNeighbor] : neighborCount;
-            }
-            noteDrawInfo.moveRight += neighborCount;
-        }
-    }
-}
-
-void MainComponent::drawText(Graphics& g, String text, float x, float y, float width, float height, bool left)
-{
-    AttributedString chordStr;
-    chordStr.setText(text);
-    chordStr.setColour(chordFadeOut.getColour());
-    chordStr.setFont(getCustomFont(pluginModel->chordFontBold).withHeight(height));
-    chordStr.setWordWrap(juce::AttributedString::WordWrap::none);
-    chordStr.setJustification(left ? juce::Justification::left : juce::Justification::centred);
-    chordStr.draw(g, Rectangle<float>(x, y, width, height));
+    chordTextCache.draw(g, text, resources->getFont(settings.chordFontBold).withHeight(height), chordFadeOut.getColour(),
+        Rectangle<float>(x, y, width, height), left ? juce::Justification::left : juce::Justification::centred);
 }
 
 
@@ -369,6 +345,17 @@ void MainComponent::onChordFadeOutStopped()
     lastChordName = "";
 }
 
+const String& MainComponent::getChordName()
+{
+    int nameId = chord.getId() * 2 + (settings.shortNotation ? 1 : 0);
+    if (nameId != cachedChordNameId)
+    {
+        cachedChordName = chord.name(settings.shortNotation);
+        cachedChordNameId = nameId;
+    }
+    return cachedChordName;
+}
+
 static float lastChordX = 0, lastChordY = 0, lastTextWidth = 0, lastTextHeight = 0;
 
 void MainComponent::paint(Graphics& g)
@@ -376,7 +363,7 @@ void MainComponent::paint(Graphics& g)
     if (pluginModel->hasParamChanges)
         onParametersChanged();
 
-    String chordName(chord.name(pluginModel->shortNotation));
+    String chordName(getChordName());
     if (chordName.length() == 0)
     {
         if (lastChordName.length() != 0)
@@ -393,9 +380,9 @@ void MainComponent::paint(Graphics& g)
     int buttonHeight = getButtonHeight(localBounds);
     int buttonSpace = buttonHeight * 0.1;
 
-    g.fillAll(pluginModel->darkMode ? darkModeBackgroundColour : Colours::white);
-    g.setColour(pluginModel->darkMode ? darkModeForegroundColour : Colours::black);
-    if (pluginModel->chordPlacement == 3)
+    g.fillAll(settings.darkMode ? darkModeBackgroundColour : Colours::white);
+    g.setColour(settings.darkMode ? darkModeForegroundColour : Colours::black);
+    if (settings.chordPlacement == 3)
     {
         float textWidth = localBounds.getWidth() - buttonSpace * 4;
         float textHeight = localBounds.getHeight() - buttonHeight - buttonSpace * 2;
@@ -405,143 +392,90 @@ void MainComponent::paint(Graphics& g)
         return;
     }
 
-    StaffCalculator staffCalculator(localBounds);
-    drawStaff(g, staffCalculator);
-    drawKeySignature(g, staffCalculator);
-        
-    //Find out where to place the notes
-    NoteDrawInfo noteDrawInfos[127];
-    std::set<int> anchorNotes;
-    for (int midiNote : midiNotes)
+    drawStaffLayer(g, staffCalculator);
+
+    if (notationLayoutDirty)
     {
-        noteDrawInfos[midiNote] = NoteDrawInfo();
-        if (keyMenu.getSelectedId() > 14)
-        {
-            bool sharp = keyMenu.getText() == Key::SHARPS ? true : false;
-            staffCalculator.noteYPlacement(midiNote, noteDrawInfos[midiNote], sharp, true, 12 * pluginModel->transposeOctaves);
-        }
-        else
-        {
-            keys.applyAnchorNoteAndAccents(midiNote, keys.getKey(keyMenu.getText()), chord, noteDrawInfos[midiNote]);
-            staffCalculator.noteYPlacement(noteDrawInfos[midiNote].anchorNote, noteDrawInfos[midiNote], false, false, 12 * pluginModel->transposeOctaves);
-        }
+        notationLayout = &notationLayoutCache.get(shownNotes, keys, keyMenu.getSelectedId() - 1, chord, settings.transposeOctaves, staffCalculator);
+        notationLayoutDirty = false;
     }
 
-    resolveNeighborConflicts(midiNotes, noteDrawInfos);
-
-    //Figure out flat/sharp indentation
-    float lastY = -1;
-    int lastAccentIndent = 0;
-    std::set<int>::reverse_iterator rit;
-    for (rit = midiNotes.rbegin(); rit != midiNotes.rend(); rit++)
+    if (notationLayout->hasAnyNotes() && (settings.chordPlacement == 1 || settings.chordPlacement == 2))
     {
-        // *rit to access value
-        int midiNote = *rit;
-        if (!noteDrawInfos[midiNote].sharp && !noteDrawInfos[midiNote].flat && !noteDrawInfos[midiNote].natural &&
-            !noteDrawInfos[midiNote].doubleSharp && !noteDrawInfos[midiNote].doubleFlat)
-            continue;
-
-        //first note always indent 0, and update lastY
-        if (lastY < 0) {
-            lastY = noteDrawInfos[midiNote].y;
-            continue;
-        }
-
-        float yDiff = noteDrawInfos[midiNote].y - lastY;
-        float diffMultiplier = noteDrawInfos[midiNote].sharp || noteDrawInfos[midiNote].doubleFlat ? 3 : 2;
-        if (yDiff < staffCalculator.noteHeight * diffMultiplier)
+        float textWidth = settings.chordPlacement == 2 ?
+            localBounds.getWidth() - notationLayout->getBaseNoteX() - staffCalculator.noteWidth * 3 :
+            localBounds.getWidth() - localBounds.getWidth() * 0.05 - buttonSpace * 8;
+        float textHeight = settings.chordPlacement == 2 ?
+            textWidth / 7.5f :
+            localBounds.getHeight() * 0.1;
+        float chordX = 0;
+        float chordY = 0;
+        if (settings.chordPlacement == 2)
         {
-            //if this is close to the indent 0 y, change indent, and don't update lastY
-            if (lastAccentIndent == 4)
-                lastAccentIndent = 0;
-            else
-                lastAccentIndent++;
-            noteDrawInfos[midiNote].accentIndent = lastAccentIndent;
+            chordX = staffCalculator.staffHeight * 1.66;
+            chordY = notationLayout->getLowestNoteY() - textHeight * 0.5 + staffCalculator.noteHeight * 0.5;
         }
-        else
-        {
-            //enough space, set indent to 0 and update lastY
-            lastAccentIndent = 0;
-            lastY = noteDrawInfos[midiNote].y;
+        else if (settings.chordPlacement == 1) {
+            chordX = buttonSpace * 6;
+            chordY = localBounds.getHeight() - textHeight - buttonSpace * 4;
         }
+        lastChordX = chordX;
+        lastChordY = chordY;
+        lastTextWidth = textWidth;
+        lastTextHeight = textHeight;
+        drawText(g, chordName, chordX, chordY, textWidth, textHeight);
     }
-    //Done finding out where to put the notes and accents
-
-    float baseNoteX = staffCalculator.x + (staffCalculator.staffHeight / 2) + (staffCalculator.staffHeight / 4) + staffCalculator.noteWidth * 4;
-    int lineX = baseNoteX - staffCalculator.lineThickness;
-    bool firstNote = true;
 
-    for (int midiNote : midiNotes)
+    glyphAtlas.update(staffCalculator, g.getInternalContext().getPhysicalPixelScaleFactor());
+    g.setColour(settings.darkMode ? darkModeForegroundColour : Colours::black);
+    for (const NotationLayout::Element& element : notationLayout->getElements())
     {
-        if (firstNote)
-        {
-            if (pluginModel->chordPlacement == 1 || pluginModel->chordPlacement == 2)
-            {
-                float textWidth = pluginModel->chordPlacement == 2 ?
-                    localBounds.getWidth() - baseNoteX - staffCalculator.noteWidth * 3 :
-                    localBounds.getWidth() - localBounds.getWidth() * 0.05 - buttonSpace * 8;
-                float textHeight = pluginModel->chordPlacement == 2 ?
-                    textWidth / 7.5f :
-                    localBounds.getHeight() * 0.1;
-                float chordX = 0;
-                float chordY = 0;
-                if (pluginModel->chordPlacement == 2)
-                {
-                    chordX = staffCalculator.staffHeight * 1.66;
-                    chordY = noteDrawInfos[midiNote].y - textHeight * 0.5 + staffCalculator.noteHeight * 0.5;
-                }
-                else if (pluginModel->chordPlacement == 1) {
-                    chordX = buttonSpace * 6;
-                    chordY = localBounds.getHeight() - textHeight - buttonSpace * 4;
-                }
-                lastChordX = chordX;
-                lastChordY = chordY;
-                lastTextWidth = textWidth;
-                lastTextHeight = textHeight;
-                drawText(g, chordName, chordX, chordY, textWidth, textHeight);
-            }
-            firstNote = false;
-        }
-
-        float noteX = baseNoteX + staffCalculator.noteWidth * noteDrawInfos[midiNote].moveRight - staffCalculator.lineThickness * noteDrawInfos[midiNote].moveRight * 2;
-        float accentX = baseNoteX - (staffCalculator.noteWidth) - (noteDrawInfos[midiNote].accentIndent * staffCalculator.noteWidth * 0.75);
-        noteSvg->drawWithin(g, Rectangle<float>(noteX, noteDrawInfos[midiNote].y - staffCalculator.lineThickness*2, staffCalculator.noteWidth, staffCalculator.noteHeight+staffCalculator.lineThickness*4), juce::RectanglePlacement::Flags::xLeft, 1.0);
-
-        for (int j=0; j<noteDrawInfos[midiNote].lineCount; j++)
-        {
-            g.drawLine(lineX, noteDrawInfos[midiNote].linePositions[j], lineX + staffCalculator.noteWidth + staffCalculator.lineThickness * 2, noteDrawInfos[midiNote].linePositions[j], staffCalculator.lineThickness);
-        }
-        if (noteDrawInfos[midiNote].sharp)
-        {
-            sharpSvg->drawWithin(g, Rectangle<float>(accentX, noteDrawInfos[midiNote].y - staffCalculator.noteHeight * 0.75, staffCalculator.noteWidth, staffCalculator.noteHeight * 2.5f), juce::RectanglePlacement::Flags::xLeft, 1.0);
-        }
-        else if (noteDrawInfos[midiNote].flat)
-        {
-            flatSvg->drawWithin(g, Rectangle<float>(accentX, noteDrawInfos[midiNote].y - staffCalculator.noteHeight * 1.25, staffCalculator.noteWidth, staffCalculator.noteHeight * 2.5f), juce::RectanglePlacement::Flags::xLeft, 1.0);
-        }
-        else if (noteDrawInfos[midiNote].natural)
-        {
-            naturalSvg->drawWithin(g, Rectangle<float>(accentX, noteDrawInfos[midiNote].y - staffCalculator.noteHeight * 0.75, staffCalculator.noteWidth, staffCalculator.noteHeight * 2.5f), juce::RectanglePlacement::Flags::xLeft, 1.0);
-        }
-        else if (noteDrawInfos[midiNote].doubleSharp)
-        {
-            doubleSharpSvg->drawWithin(g, Rectangle<float>(accentX, noteDrawInfos[midiNote].y, staffCalculator.noteWidth, staffCalculator.noteHeight), juce::RectanglePlacement::Flags::xLeft, 1.0);
-        }
-        else if (noteDrawInfos[midiNote].doubleFlat)
-        {
-            doubleFlatSvg->drawWithin(g, Rectangle<float>(accentX, noteDrawInfos[midiNote].y - staffCalculator.noteHeight * 1.25, staffCalculator.noteWidth, staffCalculator.noteHeight * 2.5f), juce::RectanglePlacement::Flags::xLeft, 1.0);
-        }
+        if (element.type == NotationLayout::glyph)
+            glyphAtlas.draw(g, element.glyph, element.x, element.y);
+        else if (element.type == NotationLayout::ledgerLine)
+            g.drawLine(element.x, element.y, element.x + element.width, element.y, element.height);
+        else
+            drawOttava(g, element);
     }
-    if (chordFadeOut.isRunning() && pluginModel->chordPlacement != 0)
+    if (chordFadeOut.isRunning() && settings.chordPlacement != 0)
     {
         drawText(g, chordName, lastChordX, lastChordY, lastTextWidth, lastTextHeight);
     }
 }
 
+void MainComponent::drawOttava(Graphics& g, const NotationLayout::Element& label)
+{
+    static const char* const ottavaLabels[] = { "15mb", "8vb", "", "8va", "15ma" };
+
+    g.setFont(resources->getFont(false).withHeight(label.height));
+    g.drawText(ottavaLabels[label.ottava + 2], Rectangle<float>(label.x, label.y, label.width, label.height), Justification::centred, false);
+}
+
+void MainComponent::drawStaffLayer(Graphics& g, StaffCalculator& staffCalculator)
+{
+    //rendered at the physical resolution so that the cached image looks the same as drawing the svgs directly
+    float scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    if (staffLayer.isNull() || staffLayerScale != scale)
+    {
+        staffLayer = Image(Image::ARGB, std::max(1, roundToInt(getWidth() * scale)), std::max(1, roundToInt(getHeight() * scale)), true);
+        Graphics layerGraphics(staffLayer);
+        layerGraphics.addTransform(AffineTransform::scale(scale));
+        drawStaff(layerGraphics, staffCalculator);
+        drawKeySignature(layerGraphics, staffCalculator);
+        staffLayerScale = scale;
+    }
+    g.drawImage(staffLayer, getLocalBounds().toFloat());
+}
+
+void MainComponent::invalidateStaffLayer()
+{
+    staffLayer = Image();
+}
+
 void MainComponent::drawStaff(Graphics& g, StaffCalculator& staffCalculator)
 {
     staffSvg->drawWithin(g, Rectangle<float>(staffCalculator.x, staffCalculator.staffYIncrement, staffCalculator.width, staffCalculator.staffHeight), RectanglePlacement::Flags::xLeft | RectanglePlacement::Flags::yMid, 1.0);
-    if (pluginModel->darkMode)
+    if (settings.darkMode)
         g.setColour(darkModeBackgroundColour);
     else
         g.setColour(Colours::white);
@@ -549,7 +483,7 @@ void MainComponent::drawStaff(Graphics& g, StaffCalculator& staffCalculator)
     //draw over left line
     g.drawLine(staffCalculator.x, staffCalculator.staffYIncrement, staffCalculator.x, staffCalculator.staffYIncrement + staffCalculator.staffHeight, staffCalculator.lineThickness * 2);
 
-    if (pluginModel->darkMode)
+    if (settings.darkMode)
         g.setColour(darkModeForegroundColour);
     else
         g.setColour(Colours::black);
@@ -557,20 +491,20 @@ void MainComponent::drawStaff(Graphics& g, StaffCalculator& staffCalculator)
 
 void MainComponent::drawKeySignature(Graphics& g, StaffCalculator& staffCalculator)
 {
-    String keyName = keyMenu.getText();
-    Key key = keys.getKey(keyName);
-    if (key.name == "Sharps" || key.name == "Flats")
+    const Key& key = keys.getKey(keyMenu.getSelectedId() - 1);
+    if (key.name == Key::SHARPS || key.name == Key::FLATS)
         return;
 
     if (key.numSharps > 0)
-        drawSharps(g, staffCalculator, key.numSharps);
+        drawSharps(g, staffCalculator, key);
     else if (key.numFlats > 0)
         drawFlats(g, staffCalculator, key.numFlats);
 }
 
-void MainComponent::drawSharps(Graphics& g, StaffCalculator& staffCalculator, int numSharps)
+void MainComponent::drawSharps(Graphics& g, StaffCalculator& staffCalculator, const Key& key)
 {
-    for (int i = 0; i < numSharps; i++)
+    //theoretical keys have more than 7 sharps, the first ones then become double sharps
+    for (int i = 0; i < jmin(key.numSharps, 7); i++)
     {
         float x1 = -1, x2 = -1, y1 = -1, y2 = -1;
         int idx = i * 2;
@@ -578,6 +512,14 @@ void MainComponent::drawSharps(Graphics& g, StaffCalculator& staffCalculator, in
         x1 = staffCalculator.sharpsX[idx] + staffCalculator.buttonSpace * 2; x2 = staffCalculator.sharpsX[idx+1] + staffCalculator.buttonSpace * 2;
         y1 = staffCalculator.sharpsY[idx]; y2 = staffCalculator.sharpsY[idx+1];
 
+        if (key.isDoubleSharp(i))
+        {
+            //a double sharp is a note high, centred where the sharp would be
+            float nh = staffCalculator.noteHeight;
+            doubleSharpSvg->drawWithin(g, Rectangle(x1, y1 + nh * 0.75f, staffCalculator.noteWidth, nh), RectanglePlacement::yMid, 1.0);
+            doubleSharpSvg->drawWithin(g, Rectangle(x2, y2 + nh * 0.75f, staffCalculator.noteWidth, nh), RectanglePlacement::yMid, 1.0);
+            continue;
+        }
         sharpSvg->drawWithin(g, Rectangle(x1, y1, staffCalculator.noteWidth, staffCalculator.noteHeight * 2.5f), RectanglePlacement::yMid, 1.0);
         sharpSvg->drawWithin(g, Rectangle(x2, y2, staffCalculator.noteWidth, staffCalculator.noteHeight * 2.5f), RectanglePlacement::yMid, 1.0);
     }
@@ -601,7 +543,10 @@ void MainComponent::drawFlats(Graphics& g, StaffCalculator& staffCalculator, int
 void MainComponent::keyMenuChanged()
 {  
     pluginModel->hasUIChanges = true;
-    pluginModel->keyId = keyMenu.getSelectedId() - 1;
+    settings.keyId = (int8)(keyMenu.getSelectedId() - 1);
+    pluginModel->setSetting(&PluginSettings::keyId, settings.keyId);
+    invalidateStaffLayer();
+    notationLayoutDirty = true;
     NullCheckedInvocation::invoke(pluginModel->paramChangedFromUI);
     repaint();
 }
\ No newline at end of file
@@ -25,17 +25,13 @@
 
 #include <JuceHeader.h>
 
-const static int CMD_MSG_MIDI_CHANGES = 10001;
 const static int CMD_MSG_VST_PARAM_CHANGES = 10002;
 const static int CMD_MSG_RESIZE = 10002;
 
-static Colour darkModeForegroundColour(236, 236, 236);
-static Colour darkModeBackgroundColour(36, 33, 33);
-static Colour darkModeSelectedBackgroundColour(95, 95, 95);
+inline const Colour darkModeForegroundColour(236, 236, 236);
+inline const Colour darkModeBackgroundColour(36, 33, 33);
+inline const Colour darkModeSelectedBackgroundColour(95, 95, 95);
 
-static Typeface::Ptr customFontTypeface = Typeface::createSystemTypefaceFor(BinaryData::consola_ttf, BinaryData::consola_ttfSize);
-static Font plainCustomFont = Font(customFontTypeface).withTypefaceStyle("Plain");
-static Font boldCustomFont = Font(Typeface::createSystemTypefaceFor(BinaryData::consola_ttf, BinaryData::consola_ttfSize)).withTypefaceStyle("Bold");
 
 
 static int floatToInt(float value)
@@ -43,6 +39,11 @@ static int floatToInt(float value)
     return static_cast<int>(round(value));
 };
 
+static constexpr bool isAccentedPitchClass(int pitchClass)
+{
+    return pitchClass == 1 || pitchClass == 3 || pitchClass == 6 || pitchClass == 8 || pitchClass == 10;
+}
+
 
 
 //==============================================================================
@@ -60,35 +61,45 @@ enum ChordType
 //==============================================================================
 struct ChordPattern
 {
-    ChordPattern()
-    {
-        pattern = "", name = "", shortName = "", chordType = None;
-    }
+    constexpr ChordPattern() {}
 
-    ChordPattern(String pattern, String name, ChordType chordType)
+    /*
+    * Everything is worked out in the constructor so that the chord dictionary can be built at compile time
+    */
+    constexpr ChordPattern(const char* pattern, const char* name, const wchar_t* shortName, ChordType chordType) :
+        mask(patternToMask(pattern)), name(name), shortName(shortName), chordType(chordType)
     {
-        this->pattern = pattern;
-        this->name = name;
-        this->shortName = name;
-        this->chordType = chordType;
-        init();
+        flat9 = (mask & (1 << 1)) != 0;
+        flat5 = chordType != Tritonic && (mask & (1 << 6)) != 0;
+        flat11 = nameContains(name, 'b', '1');
+        flat13 = nameContains(name, 'b', '3');
+        sharp5 = chordType == Aug;
+        sharp9 = chordType != Minor && chordType != Dim && (mask & (1 << 3)) != 0;
+        if (nameContains(name, '#', '1'))
+        {
+            sharp11 = true;
+            flat5 = false;
+        }
     }
 
-    ChordPattern(String pattern, String name, String shortName, ChordType chordType)
+    /*
+    * Converts a "100010010000" style pattern into a 12 bit mask, bit 0 being the lowest note
+    */
+    static constexpr int patternToMask(const char* pattern)
     {
-        this->pattern = pattern;
-        this->name = name;
-        this->shortName = shortName;
-        this->chordType = chordType;
-        init();
+        int mask = 0;
+        for (int idx = 0; idx < 12 && pattern[idx] != 0; idx++)
+        {
+            if (pattern[idx] == '1')
+                mask |= 1 << idx;
+        }
+        return mask;
     }
 
-    void init();
-
-    String pattern;
-    String name;
-    String shortName;
-    ChordType chordType;
+    int mask = 0;
+    const char* name = "";
+    const wchar_t* shortName = L"";
+    ChordType chordType = None;
     bool flat5 = false;
     bool flat9 = false;
     bool flat11 = false;
@@ -96,39 +107,90 @@ struct ChordPattern
     bool sharp5 = false;
     bool sharp9 = false;
     bool sharp11 = false;
+
+private:
+    //looks for e.g. "b11" or "#13" in the chord name
+    static constexpr bool nameContains(const char* name, char accent, char lastDigit)
+    {
+        for (int idx = 0; name[idx] != 0 && name[idx + 1] != 0; idx++)
+        {
+            if (name[idx] == accent && name[idx + 1] == '1' && name[idx + 2] == lastDigit)
+                return true;
+        }
+        return false;
+    }
 };
 
-static ChordPattern nullPattern = ChordPattern();
+inline constexpr ChordPattern nullPattern = ChordPattern();
 
 //==============================================================================
+struct ChordResolution
+{
+    int16 patternIndex = -1;
+    int8 rootOffset = 0; //semitones from the bass note up to the chord root
+};
+
+//==============================================================================
+/*
+* A recognized chord is a handful of small integers, copying it around never allocates.
+* Names are put together from interned strings, see Chords::getNoteName and Chords::getPatternName
+*/
 struct Chord
 {
-    Chord(ChordPattern pattern = nullPattern, String rootNote = "", String bassNote = "");
-    String name(bool shortName = false);
+    String name(bool shortName = false) const;
+    const ChordPattern& getPattern() const;
+    const String& getRootName() const;
+    const String& getBassName() const;
+
+    bool isNull() const
+    {
+        return patternIndex < 0;
+    }
+
+    //uniquely identifies the chord including its spelling, 0 means no chord
+    int getId() const
+    {
+        return (patternIndex + 1) | ((rootNote + 1) << 11) | ((bassNote + 1) << 15) |
+            (rootSharp ? 1 << 19 : 0) | (bassSharp ? 1 << 20 : 0) | ((easterEgg + 1) << 21);
+    }
+
+    bool operator==(const Chord& other) const
+    {
+        return getId() == other.getId();
+    }
+
+    bool operator!=(const Chord& other) const
+    {
+        return getId() != other.getId();
+    }
 
-    ChordPattern pattern;
-    String rootNote;
-    String bassNote;
+    int16 patternIndex = -1;
+    ChordType chordType = None;
+    int8 rootNote = -1; //pitch class of the chord root
+    int8 bassNote = -1; //pitch class of the bass note when it's not the root
+    bool rootSharp = false; //accented root note is spelled with a sharp rather than a flat
+    bool bassSharp = false;
+    int8 easterEgg = -1;
 
     bool isMajor3rd() const
     {
-        return pattern.chordType == Major || pattern.chordType == Sus || pattern.chordType == Aug;
+        return chordType == Major || chordType == Sus || chordType == Aug;
     };
 
     bool isMinor3rd() const
     {
-        return pattern.chordType == Minor || pattern.chordType == Dim;
+        return chordType == Minor || chordType == Dim;
     };
-    bool isFlat5(int midiNote);
-    bool isFlat9(int midiNote);
-    bool isFlat11(int midiNote);
-    bool isFlat13(int midiNote);
-    bool isSharp5(int midiNote);
-    bool isSharp9(int midiNote);
-    bool isSharp11(int midiNote);
+    bool isFlat5(int midiNote) const;
+    bool isFlat9(int midiNote) const;
+    bool isFlat11(int midiNote) const;
+    bool isFlat13(int midiNote) const;
+    bool isSharp5(int midiNote) const;
+    bool isSharp9(int midiNote) const;
+    bool isSharp11(int midiNote) const;
 };
 
-static Chord nullChord = Chord();
+inline constexpr Chord nullChord = Chord();
 
 //==============================================================================
 struct NoteDrawInfo
@@ -141,21 +203,70 @@ struct NoteDrawInfo
     bool doubleSharp = false;
     bool doubleFlat = false;
     int accentIndent = 0;
+    static constexpr int maxLineCount = 18; //G9, the highest midi note, needs 18 ledger lines above the G-clef
     int lineCount = 0;
-    float linePositions[5];
+    float linePositions[maxLineCount];
     int midiNote = -1;
     int anchorNote = -1; //where the note will be drawn, e.g. F# on F, Ab on A
+    int ottava = 0; //octaves the note is drawn away from where it's played, 1 is 8va, 2 is 15ma, -1 is 8vb and -2 is 15mb
     int moveRight = 0;
 };
 //==============================================================================
+/*
+* Places the accidentals of a chord in columns to the left of the note heads, so that none of them collide.
+* Accidentals are taken in zig-zag order (highest, lowest, second highest, second lowest...) and each one goes into
+* the column closest to the notes where it fits.
+*/
+class AccidentalStacking final {
+public:
+    struct Accidental
+    {
+        int midiNote = -1;
+        float top = 0;
+        float bottom = 0;
+        int column = 0;
+    };
+
+    static constexpr int maxColumns = 12;
+
+    //the vertical extent of the accidental glyph drawn for a note, false if the note has no accidental
+    static bool getAccidental(int midiNote, const NoteDrawInfo& noteDrawInfo, float noteHeight, Accidental& accidental);
+    /*
+    * Sorts the accidentals top to bottom, then assigns a column to each one, column 0 being next to the notes.
+    * Returns the number of columns used.
+    */
+    static int stack(Accidental* accidentals, int numAccidentals);
+};
+//==============================================================================
 struct Key
 {
     String name;
-    std::list<String> notes;
-    int numSharps = 0;
+    uint16 pitchClasses = 0; //bit n is set when pitch class n is in the scale
+    int8 alterations[7] = {}; //how each letter from C to B is spelled in the key, -1 is flat and 1 is sharp
+    int fifths = 0; //the key signature on the line of fifths, sharps are positive and flats negative
+    bool minor = false;
+    int numSharps = 0; //above 7 the first sharps are double sharps
     int numFlats = 0;
-    bool hasNote(String& noteName);
-    String selectChordBaseNoteName(int midiNote, ChordType chordType);
+    int index = -1; //the key id, position in Keys::getKeyNames
+    bool useSharpForChordBaseNote(int midiNote, ChordType chordType) const;
+
+    bool hasPitchClass(int pitchClass) const
+    {
+        return (pitchClasses >> pitchClass) & 1;
+    }
+
+    //the root of a minor key is three fifths above the root of its relative major
+    int getRootFifths() const
+    {
+        return minor ? fifths + 3 : fifths;
+    }
+
+    //whether the key signature's sharp at this position, in the order F C G D A E B, is a double sharp
+    bool isDoubleSharp(int sharpIndex) const
+    {
+        static const int sharpLetters[] = { 3, 0, 4, 1, 5, 2, 6 };
+        return alterations[sharpLetters[sharpIndex]] == 2;
+    }
 
     inline static const String SHARPS = "Sharps";
     inline static const String FLATS = "Flats";
@@ -164,81 +275,308 @@ struct Key
 class Keys
 {
 public:
+    static constexpr int numKeys = 35;
+
     Keys();
-    std::vector<String> getKeyNames();
-    int getKeyIndex(String name);
-    Key getKey(String name);
+    std::vector<String> getKeyNames() const;
+    int getKeyIndex(const String& name) const;
+    //key ids for the key menu, grouped into major keys, minor keys and the rest, -1 between groups
+    std::vector<int> getMenuOrder() const;
+    //keyId is the position in getKeyNames, any other id gives a key without notes
+    const Key& getKey(int keyId) const;
     String selectChordName(String keyName, String sharpChordName, String flatChordName);
-    void applyAnchorNoteAndAccents(int midiNote, Key& key, Chord& chord, NoteDrawInfo& noteDrawInfo);
+    //sets the anchor note and accidentals from the spelling table, overwriting what was there
+    void applyAnchorNoteAndAccents(int midiNote, const Key& key, const Chord& chord, NoteDrawInfo& noteDrawInfo) const;
 
 private:
-    void addKey(String name, std::list<String>& notes, int numSharps, int numFlats);
-    void applyAnchorNoteAndAccentsUsingChordKey(int midiNote, Key& key, Chord& chord, NoteDrawInfo& noteDrawInfo);
-    void applyDimAnchorNoteAndAccents(int midiNote, String& noteName, Key& key, Chord& chord, NoteDrawInfo& noteDrawInfo);
-    std::map<String, Key> keys;
-    std::vector<String> keyNames;
+    void addKey(const String& name, int fifths, bool minor = false);
+    /*
+    * Spelling a note only depends on the key, the kind of chord, its root, whether the note is a flat or sharp interval
+    * of the chord and the pitch class. Every combination is worked out once, each entry holds the anchor offset
+    * (plus 2) in the low three bits and then one bit for each of sharp, flat, natural, double sharp and double flat
+    */
+    void buildSpellingTable();
+    static int getSpellingIndex(int keyIndex, int chordKind, int rootIndex, int interval, int pitchClass);
+    Key keys[numKeys];
+    int numAddedKeys = 0;
+    Key noKey;
+    std::vector<uint8> spellingTable;
 };
 //==============================================================================
 class Chords
 {
 public:
-    Chords();
-
     /*
     * The chord recognition algorithm is based on the Chordback JSFX script written by Paul Heams
     * He can be contacted on X (Twitter) as @17BitRetro
     */
-    void name(std::set<int>& midiNotes, Key& key, Chord& chord);
+    void name(std::set<int>& midiNotes, const Key& key, Chord& chord);
 
-    static bool chordHasSuperPower(Chord& chord)
+    static bool chordHasSuperPower(const Chord& chord)
     {
-        if (chord.isMajor3rd() && (chord.rootNote == "Bb" || chord.rootNote == "Eb" || chord.rootNote == "C" || chord.rootNote == "D" ||
-            chord.rootNote == "E" || chord.rootNote == "F" || chord.rootNote == "G" || chord.rootNote == "A" || chord.rootNote == "B"))
+        bool flatRoot = isAccentedPitchClass(chord.rootNote) && !chord.rootSharp;
+        if (chord.isMajor3rd() && (!isAccentedPitchClass(chord.rootNote) || (flatRoot && (chord.rootNote == 10 || chord.rootNote == 3)))) //naturals, Bb and Eb
             return true;
-        else if (chord.pattern.chordType == Minor && (chord.rootNote == "C" || chord.rootNote == "D" || chord.rootNote == "E" || chord.rootNote == "G" ||
-            chord.rootNote == "A" || chord.rootNote == "B"))
+        else if (chord.chordType == Minor && !isAccentedPitchClass(chord.rootNote) && chord.rootNote != 5) //naturals except F
             return true;
         return false;
     }
 
-    static bool isChordSharp(Chord& chord)
+    static bool isChordSharp(const Chord& chord)
     {
-        if (chord.isMajor3rd() && (chord.rootNote == "Eb" || chord.rootNote == "Bb" || chord.rootNote == "F" || chord.rootNote == "C"))
+        bool flatRoot = isAccentedPitchClass(chord.rootNote) && !chord.rootSharp;
+        if (chord.isMajor3rd() && (chord.rootNote == 0 || chord.rootNote == 5 || (flatRoot && (chord.rootNote == 3 || chord.rootNote == 10)))) //C, F, Eb and Bb
             return false;
-        else if (chord.isMinor3rd() && (chord.rootNote == "C" || chord.rootNote == "G" || chord.rootNote == "D" || chord.rootNote == "A"))
+        else if (chord.isMinor3rd() && (chord.rootNote == 0 || chord.rootNote == 7 || chord.rootNote == 2 || chord.rootNote == 9)) //C, G, D and A
             return false;
         return true;
     }
 
+    static const String& getNoteName(int pitchClass, bool sharp);
+    static const String& getEasterEggName(int easterEgg);
+
+    //the pattern table is defined in ChordDefinitions.cpp
+    static const ChordPattern& getPattern(int patternIndex);
+    static int getNumPatterns();
+    static const String& getPatternName(int patternIndex, bool shortName);
+
 private:
-    std::map<String, ChordPattern> patterns;
+    static const ChordResolution& getResolution(int chordMask);
 };
 //==============================================================================
-class PluginModel
+//one bit for each of the 128 midi notes
+struct NoteMask
+{
+    uint64 bits[2] = { 0, 0 };
+
+    bool test(int midiNote) const
+    {
+        return (bits[midiNote >> 6] >> (midiNote & 63)) & 1;
+    }
+
+    void set(int midiNote, bool on)
+    {
+        uint64 bit = (uint64)1 << (midiNote & 63);
+        bits[midiNote >> 6] = on ? bits[midiNote >> 6] | bit : bits[midiNote >> 6] & ~bit;
+    }
+
+    void clear()
+    {
+        bits[0] = bits[1] = 0;
+    }
+
+    bool isEmpty() const
+    {
+        return (bits[0] | bits[1]) == 0;
+    }
+
+    bool operator==(const NoteMask& other) const
+    {
+        return bits[0] == other.bits[0] && bits[1] == other.bits[1];
+    }
+
+    bool operator!=(const NoteMask& other) const
+    {
+        return !(*this == other);
+    }
+};
+
+/*
+* Sequence lock for handing a small, trivially copyable value from one writer thread to readers.
+* The writer never waits, a reader retries in the rare case it overlaps a write. The value is kept in atomic words
+* so that no thread ever touches memory the other one is writing non-atomically
+*/
+template <typename T>
+class SeqLock
 {
 public:
-    int midiNotes[127];
-    int transposeOctaves = 0;
-    int keyId = 0;
+    SeqLock(const T& value = T())
+    {
+        write(value);
+    }
+
+    //only ever call from one thread at a time
+    void write(const T& value)
+    {
+        uint64 buffer[numWords] = {};
+        std::memcpy(buffer, &value, sizeof(T));
+
+        uint32 sequence = sequenceNumber.load(std::memory_order_relaxed);
+        sequenceNumber.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (int i = 0; i < numWords; i++)
+            words[i].store(buffer[i], std::memory_order_relaxed);
+        sequenceNumber.store(sequence + 2, std::memory_order_release);
+    }
+
+    T read() const
+    {
+        uint64 buffer[numWords];
+        for (;;)
+        {
+            uint32 before = sequenceNumber.load(std::memory_order_acquire);
+            if ((before & 1) == 0)
+            {
+                for (int i = 0; i < numWords; i++)
+                    buffer[i] = words[i].load(std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (sequenceNumber.load(std::memory_order_relaxed) == before)
+                    break;
+            }
+        }
+
+        T value;
+        std::memcpy(&value, buffer, sizeof(T));
+        return value;
+    }
+
+private:
+    static_assert(std::is_trivially_copyable<T>::value, "SeqLock values are copied as raw words");
+    static constexpr int numWords = (int)((sizeof(T) + sizeof(uint64) - 1) / sizeof(uint64));
+
+    std::atomic<uint32> sequenceNumber { 0 };
+    std::atomic<uint64> words[numWords];
+};
+//==============================================================================
+struct MidiNoteEvent
+{
+    int64 samplePosition = 0; //counted from when the plugin started processing
+    int8 note = 0;
+    uint8 velocity = 0;
+    bool on = false;
+    int8 channel = 0;
+};
+
+/*
+* Single producer, single consumer queue of note events. The audio thread pushes every note on/off it sees,
+* the editor drains them so that notes starting and ending within one block can still be shown
+*/
+class MidiEventQueue
+{
+public:
+    //audio thread, never blocks or allocates. Events are dropped when the editor isn't draining the queue
+    bool push(const MidiNoteEvent& event)
+    {
+        if (fifo.getFreeSpace() == 0)
+        {
+            numDropped++;
+            return false;
+        }
+        fifo.write(1).forEach([&](int index) { events[index] = event; });
+        return true;
+    }
+
+    //message thread
+    int pop(MidiNoteEvent* destination, int maxEvents)
+    {
+        int numRead = 0;
+        fifo.read(jmin(maxEvents, fifo.getNumReady())).forEach([&](int index) { destination[numRead++] = events[index]; });
+        return numRead;
+    }
+
+    //message thread, throws away whatever piled up while nobody was listening
+    void discardAll()
+    {
+        fifo.read(fifo.getNumReady());
+    }
+
+    int getNumDropped() const
+    {
+        return numDropped.load();
+    }
+
+private:
+    static constexpr int capacity = 1024;
+    AbstractFifo fifo { capacity };
+    MidiNoteEvent events[capacity];
+    std::atomic<int> numDropped { 0 };
+};
+//==============================================================================
+//the user settings, shared between the host, the audio thread and the editor as one value that fits in a single atomic word
+struct PluginSettings
+{
+    int8 transposeOctaves = 0;
+    int8 keyId = 0;
     bool holdNotes = false;
     bool shortNotation = false;
-    int chordPlacement = 1;
+    int8 chordPlacement = 1;
     bool chordFontBold = false;
     bool darkMode = false;
-    bool hasParamChanges = false;
-    bool hasUIChanges = false;
-    int uiWidth = -1;
-    int uiHeight = -1;
+};
+//==============================================================================
+class PluginModel
+{
+public:
+    SeqLock<NoteMask> midiNotes; //written by the audio thread only, the editor reads snapshots
+    MidiEventQueue midiEvents;
+    std::atomic<uint32> midiChangeCount { 0 }; //bumped by the audio thread every time midiNotes is written
+    std::atomic<int> midiNotesResetRequests { 0 }; //the editor asks the audio thread to clear held notes
+    std::atomic<int> midiNotesResetsHandled { 0 }; //the last request the audio thread cleared, set after midiNotes is written
+    std::atomic<bool> hasParamChanges { false };
+    std::atomic<bool> hasUIChanges { false };
+    //written by the editor on resize, read and restored with the state from whichever thread the host uses
+    std::atomic<int> uiWidth { -1 };
+    std::atomic<int> uiHeight { -1 };
+
+    //a consistent copy of all settings, never blocks so the audio thread can take one per block
+    PluginSettings getSettings() const
+    {
+        return unpackSettings(settings.load(std::memory_order_acquire));
+    }
+
+    /*
+    * The host and the editor both change settings, from whichever thread they are on, host automation included
+    * from the audio thread. Each changes just its own field of the latest settings
+    */
+    template <typename Value, typename NewValue>
+    void setSetting(Value PluginSettings::* field, NewValue value)
+    {
+        updateSettings([&](PluginSettings& newSettings) { newSettings.*field = (Value)value; });
+    }
+
+    /*
+    * update gets the latest settings to change in place. Writers never wait on each other: one that loses the race
+    * to another runs update again on what the other wrote, so update must not do anything besides changing them
+    */
+    template <typename Function>
+    void updateSettings(Function&& update)
+    {
+        uint64 expected = settings.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            PluginSettings newSettings = unpackSettings(expected);
+            update(newSettings);
+            if (settings.compare_exchange_weak(expected, packSettings(newSettings), std::memory_order_release, std::memory_order_relaxed))
+                return;
+        }
+    }
 
-    void resetMidiNotes()
+    void setSettings(const PluginSettings& newSettings)
     {
-        for (int i = 0; i < 127; i++)
-            midiNotes[i] = 0;
+        settings.store(packSettings(newSettings), std::memory_order_release);
     }
+
     std::function<void()> paramChangedFromUI;
-    std::function<void()> paramChangedFromHost;
 
-    CriticalSection criticalSection;
+private:
+    static_assert(sizeof(PluginSettings) <= sizeof(uint64) && std::is_trivially_copyable<PluginSettings>::value,
+        "PluginSettings is swapped as one atomic word");
+
+    static uint64 packSettings(const PluginSettings& value)
+    {
+        uint64 word = 0;
+        std::memcpy(&word, &value, sizeof(PluginSettings));
+        return word;
+    }
+
+    static PluginSettings unpackSettings(uint64 word)
+    {
+        PluginSettings value;
+        std::memcpy(&value, &word, sizeof(PluginSettings));
+        return value;
+    }
+
+    std::atomic<uint64> settings { packSettings(PluginSettings()) };
 };
 
 //==============================================================================
@@ -246,7 +584,12 @@ class StaffCalculator
 {
 public:
     StaffCalculator(Rectangle<int> bounds);
-    void noteYPlacement(int midiNote, NoteDrawInfo& noteDrawInfo, bool sharp=false, bool applySharpFlat=true, int transpose=0);
+    void noteYPlacement(int midiNote, NoteDrawInfo& noteDrawInfo, bool sharp=false, bool applySharpFlat=true, int transpose=0) const;
+    static int getDiatonicStep(int midiNote);
+    static int getLedgerLineCount(int diatonicStep);
+
+    //notes needing more ledger lines than this are drawn an octave (or two) closer to the staff
+    static constexpr int maxLedgerLines = 4;
     
     float buttonHeight;
     float buttonSpace;
@@ -268,28 +611,8 @@ public:
     float staffYIncrement;
     float staffHeight;
 
-    float g5;
-    float e5;
-    float c5;
-    float a4;
-
     float c3;
 
-    float e1;
-    float c1;
-    float a0;
-    float f0;
-
-    float gLine1;
-    float gLine2;
-    float gLine3;
-    float gLine4;
-    float c3Line;
-    float fLine1;
-    float fLine2;
-    float fLine3;
-    float fLine4;
-
     float sharpFontSize;
     float flatFontSize;
 
@@ -298,6 +621,26 @@ public:
     float flatsX[14];//Bb Eb Ab Db Gb Cb Fb
     float flatsY[14];
 private:
+    float diatonicStepYPlacement(int diatonicStep) const;
+    void buildNotePlacements();
+
+    //diatonic steps are counted from C0 (midi note 12), midi note 0 is C-1
+    static constexpr int lowestDiatonicStep = -7;
+    static constexpr int numDiatonicSteps = 75;
+
+    struct NotePlacement
+    {
+        int diatonicStep = 0;
+        float y = -500;
+        int lineCount = 0;
+        int firstLineStep = 0; //ledger lines are drawn through every other step from here
+        int lineStepDirection = 0;
+        int ottava = 0;
+    };
+
+    //worked out once per layout, noteYPlacement only looks things up
+    float diatonicStepY[numDiatonicSteps];
+    NotePlacement notePlacements[128];
 };
 //==============================================================================
 class CustomDrawableButton : public DrawableButton
@@ -322,9 +665,54 @@ private:
 };
 //==============================================================================
 
-static float fontHeightMultiplier = 0.7;
-static LookAndFeel* defaultLookAndFeel = nullptr;
+inline constexpr float fontHeightMultiplier = 0.7f;
 
+/*
+* Everything that is the same for all plugin instances: the font, the svgs and the key tables. Each editor holds a
+* SharedResourcePointer, so the first one to open creates it and it goes away with the last one.
+* The svgs of a theme are parsed the first time one of them is asked for, only from the message thread
+*/
+class SharedResources final
+{
+public:
+    enum DrawableId { staff, note, increment, sharp, flat, natural, doubleSharp, doubleFlat, arrowDown, arrowRight, arrowUp, numDrawables };
+
+    SharedResources();
+
+    Drawable* getDrawable(DrawableId id, bool darkMode);
+
+    Drawable* getBlank() const
+    {
+        return blank.get();
+    }
+
+    const Font& getFont(bool bold) const
+    {
+        return bold ? boldFont : plainFont;
+    }
+
+    Typeface::Ptr getTypeface() const
+    {
+        return typeface;
+    }
+
+    const Keys& getKeys() const
+    {
+        return keys;
+    }
+
+private:
+    void loadTheme(int theme);
+
+    Typeface::Ptr typeface;
+    Font plainFont;
+    Font boldFont;
+    std::unique_ptr<Drawable> drawables[2][numDrawables];
+    bool themeLoaded[2] = { false, false };
+    std::unique_ptr<Drawable> blank;
+    Keys keys;
+};
+//==============================================================================
 class CustomLookAndFeel : public LookAndFeel_V4
 {
 public:
@@ -350,16 +738,8 @@ public:
         return BubbleComponent::below;
     }
 
-    static Font getCustomFont()
-    {
-        plainCustomFont.setTypefaceName("Consolas");
-        plainCustomFont.setTypefaceStyle("Plain");
-        return plainCustomFont;
-    }
-
 private:
-    const std::unique_ptr<Drawable> lmKeySelectorArrowDownSvg = Drawable::createFromImageData(BinaryData::KeySelectorArrowDown_svg, BinaryData::KeySelectorArrowDown_svgSize);
-    const std::unique_ptr<Drawable> dmKeySelectorArrowDownSvg = Drawable::createFromImageData(BinaryData::KeySelectorArrowDownDarkMode_svg, BinaryData::KeySelectorArrowDownDarkMode_svgSize);
+    SharedResourcePointer<SharedResources> resources;
     bool darkMode = false;
 };
 //==============================================================================
@@ -372,6 +752,155 @@ class OctaveSlider : public Slider
     }
 };
 //==============================================================================
+/*
+* Keeps the last few laid out chord names around so that repainting the same chord (e.g. every frame of a fade out)
+* doesn't have to shape the text again. The colour isn't part of the layout, it's applied to the cached runs
+*/
+class ChordTextCache final {
+public:
+    void draw(Graphics& g, const String& text, const Font& font, Colour colour, Rectangle<float> area, Justification justification);
+
+private:
+    struct Entry
+    {
+        String text;
+        Font font { FontOptions() };
+        float width = 0;
+        float height = 0;
+        int justification = 0;
+        Colour colour;
+        TextLayout layout;
+        bool used = false;
+    };
+
+    static constexpr int numEntries = 4;
+    Entry entries[numEntries];
+    int nextEntry = 0;
+};
+//==============================================================================
+/*
+* Note heads and accidentals pre-rendered at the current note size and pixel scale, for both themes.
+* Drawing a note is then an image blit instead of walking the svg paths again
+*/
+class GlyphAtlas final {
+public:
+    enum Glyph { noteHead, sharp, flat, natural, doubleSharp, doubleFlat, numGlyphs };
+
+    //the active theme's drawables in Glyph order, they must outlive the atlas
+    void setDrawables(const std::array<Drawable*, numGlyphs>& glyphDrawables);
+    //re-renders the atlas if the note size or the pixel scale changed since last time
+    void update(const StaffCalculator& staffCalculator, float pixelScale);
+    //x and y are the top left of the same box the svg would have been drawn within
+    void draw(Graphics& g, Glyph glyph, float x, float y) const;
+
+private:
+    Rectangle<float> getGlyphBox(Glyph glyph) const;
+
+    std::array<Drawable*, numGlyphs> drawables = {};
+    Image atlas;
+    Image glyphImages[numGlyphs];
+    float noteWidth = 0;
+    float noteHeight = 0;
+    float lineThickness = 0;
+    float scale = 0;
+};
+//==============================================================================
+/*
+* Works out where everything for the played notes goes: spelling, placement on the staff, neighbor conflicts
+* and accidental stacking. The result is a flat list of what to draw, it only needs to be rebuilt when the notes,
+* the key, the transposition or the size change. Nothing in here touches components, so it can run on any thread.
+*/
+class NotationLayout final {
+public:
+    enum ElementType { glyph, ledgerLine, ottavaLabel };
+
+    struct Element
+    {
+        ElementType type;
+        GlyphAtlas::Glyph glyph; //for glyphs
+        int ottava; //for ottava labels
+        float x; //glyphs are at the top left of their box, ledger lines start at x and y
+        float y;
+        float width; //ledger line length and label box
+        float height; //ledger line thickness and label box
+    };
+
+    //Sharps and Flats keys spell every accented note the same way, other keys spell notes from the key and chord
+    void build(const NoteMask& notes, const Keys& keys, const Key& key, const Chord& chord, int transposeOctaves, const StaffCalculator& staffCalculator);
+
+    const std::vector<Element>& getElements() const
+    {
+        return elements;
+    }
+
+    bool hasAnyNotes() const
+    {
+        return hasNotes;
+    }
+
+    //the lowest note is where the chord name goes when it's placed to the right
+    float getLowestNoteY() const
+    {
+        return lowestNoteY;
+    }
+
+    //left edge of the note heads that haven't been moved right
+    float getBaseNoteX() const
+    {
+        return baseNoteX;
+    }
+
+    //sets moveRight for notes a second apart or on the same step, midiNotes index noteDrawInfos
+    static void resolveNeighborConflicts(const int* midiNotes, int numNotes, NoteDrawInfo* noteDrawInfos);
+
+private:
+    std::vector<Element> elements;
+    bool hasNotes = false;
+    float lowestNoteY = 0;
+    float baseNoteX = 0;
+};
+//==============================================================================
+/*
+* The last few layouts, keyed by the notes, key, chord and transposition they were built for.
+* Players keep coming back to the same voicings, so most of the time a layout doesn't need to be built at all.
+* It has to be cleared when the staff geometry changes.
+*/
+class NotationLayoutCache final {
+public:
+    //the layout stays valid until the next call to get or clear
+    const NotationLayout& get(const NoteMask& notes, const Keys& keys, int keyId, const Chord& chord, int transposeOctaves,
+        const StaffCalculator& staffCalculator);
+    void clear();
+
+    int64 getNumHits() const
+    {
+        return numHits;
+    }
+
+    int64 getNumMisses() const
+    {
+        return numMisses;
+    }
+
+private:
+    struct Entry
+    {
+        NoteMask notes;
+        int keyId = -1;
+        int chordId = 0;
+        int transposeOctaves = 0;
+        uint32 lastUsed = 0;
+        bool used = false;
+        NotationLayout layout;
+    };
+
+    static constexpr int numEntries = 16;
+    Entry entries[numEntries];
+    uint32 useCount = 0;
+    int64 numHits = 0;
+    int64 numMisses = 0;
+};
+//==============================================================================
 class FadeOut final {
 public:
     FadeOut(Component* owner, PluginModel* model) :
@@ -423,7 +952,6 @@ public:
     }
     ~MainComponent()
     {
-        pluginModel->paramChangedFromHost = nullptr;
         keyMenu.setLookAndFeel(nullptr);
         notationButton.setLookAndFeel(nullptr);
         chordFontBoldButton.setLookAndFeel(nullptr);
@@ -441,42 +969,46 @@ public:
     void onParametersChanged();
     void onMidiChanged();
 
+    //audio blocks whose note changes were folded into a later display refresh
+    int64 getNumCoalescedMidiUpdates() const
+    {
+        return numCoalescedMidiUpdates;
+    }
+
+    //repaints that found their note layout in the cache, and the ones that had to build it
+    int64 getNumLayoutCacheHits() const
+    {
+        return notationLayoutCache.getNumHits();
+    }
+
+    int64 getNumLayoutCacheMisses() const
+    {
+        return notationLayoutCache.getNumMisses();
+    }
+
+    //the staff geometry paint uses, kept up to date by resized()
+    const StaffCalculator& getStaffCalculator() const
+    {
+        return staffCalculator;
+    }
+
 private:
     void init(PluginModel* model);
+    void onVBlank();
     void keyMenuChanged();
+    void drawStaffLayer(Graphics& g, StaffCalculator& staffCalculator);
+    void invalidateStaffLayer();
     void drawStaff(Graphics& g, StaffCalculator& staffCalculator);
     void drawKeySignature(Graphics& g, StaffCalculator& staffCalculator);
-    void drawSharps(Graphics& g, StaffCalculator& staffCalculator, int numSharps);
+    void drawSharps(Graphics& g, StaffCalculator& staffCalculator, const Key& key);
     void drawFlats(Graphics& g, StaffCalculator& staffCalculator, int numFlats);
-    void drawText(Graphics& g, String text, float x, float y, float width, float height, bool left = true);
+    void drawText(Graphics& g, const String& text, float x, float y, float width, float height, bool left = true);
+    void drawOttava(Graphics& g, const NotationLayout::Element& label);
     void onChordFadeOutStopped();
+    const String& getChordName();
 
 
-    const std::unique_ptr<Drawable> lmStaffSvg = Drawable::createFromImageData(BinaryData::Grand_staff_02_svg, BinaryData::Grand_staff_02_svgSize);
-    const std::unique_ptr<Drawable> lmNoteSvg = Drawable::createFromImageData(BinaryData::Whole_note_svg, BinaryData::Whole_note_svgSize);
-    const std::unique_ptr<Drawable> lmIncrementSvg = Drawable::createFromImageData(BinaryData::Increment_Symbol_svg, BinaryData::Increment_Symbol_svgSize);
-    const std::unique_ptr<Drawable> lmSharpSvg = Drawable::createFromImageData(BinaryData::Sharp_svg, BinaryData::Sharp_svgSize);
-    const std::unique_ptr<Drawable> lmFlatSvg = Drawable::createFromImageData(BinaryData::Flat_svg, BinaryData::Flat_svgSize);
-    const std::unique_ptr<Drawable> lmNaturalSvg = Drawable::createFromImageData(BinaryData::Natural_svg, BinaryData::Natural_svgSize);
-    const std::unique_ptr<Drawable> lmDoubleSharpSvg = Drawable::createFromImageData(BinaryData::DoubleSharp_svg, BinaryData::DoubleSharp_svgSize);
-    const std::unique_ptr<Drawable> lmDoubleFlatSvg = Drawable::createFromImageData(BinaryData::DoubleFlat_svg, BinaryData::DoubleFlat_svgSize);
-    const std::unique_ptr<Drawable> lmArrowDownSvg = Drawable::createFromImageData(BinaryData::ArrowDown_svg, BinaryData::ArrowDown_svgSize);
-    const std::unique_ptr<Drawable> lmArrowRightSvg = Drawable::createFromImageData(BinaryData::ArrowRight_svg, BinaryData::ArrowRight_svgSize);
-    const std::unique_ptr<Drawable> lmArrowUpSvg = Drawable::createFromImageData(BinaryData::ArrowUp_svg, BinaryData::ArrowUp_svgSize);
-
-    const std::unique_ptr<Drawable> dmStaffSvg = Drawable::createFromImageData(BinaryData::Dark_Mode_Grand_Staff_svg, BinaryData::Dark_Mode_Grand_Staff_svgSize);
-    const std::unique_ptr<Drawable> dmNoteSvg = Drawable::createFromImageData(BinaryData::Dark_Mode_Whole_Note_svg, BinaryData::Dark_Mode_Whole_Note_svgSize);
-    const std::unique_ptr<Drawable> dmIncrementSvg = Drawable::createFromImageData(BinaryData::Dark_Mode_Increment_Symbol_svg, BinaryData::Dark_Mode_Increment_Symbol_svgSize);
-    const std::unique_ptr<Drawable> dmSharpSvg = Drawable::createFromImageData(BinaryData::Dark_Mode_Sharp_svg, BinaryData::Dark_Mode_Sharp_svgSize);
-    const std::unique_ptr<Drawable> dmFlatSvg = Drawable::createFromImageData(BinaryData::Dark_Mode_Flat_svg, BinaryData::Dark_Mode_Flat_svgSize);
-    const std::unique_ptr<Drawable> dmNaturalSvg = Drawable::createFromImageData(BinaryData::Dark_Mode_Natural_svg, BinaryData::Dark_Mode_Natural_svgSize);
-    const std::unique_ptr<Drawable> dmDoubleSharpSvg = Drawable::createFromImageData(BinaryData::Dark_Mode_Double_Sharp_svg, BinaryData::Dark_Mode_Double_Sharp_svgSize);
-    const std::unique_ptr<Drawable> dmDoubleFlatSvg = Drawable::createFromImageData(BinaryData::Dark_Mode_Double_Flat_svg, BinaryData::Dark_Mode_Double_Flat_svgSize);
-    const std::unique_ptr<Drawable> dmArrowDownSvg = Drawable::createFromImageData(BinaryData::ArrowDownDarkMode_svg, BinaryData::ArrowDownDarkMode_svgSize);
-    const std::unique_ptr<Drawable> dmArrowRightSvg = Drawable::createFromImageData(BinaryData::ArrowRightDarkMode_svg, BinaryData::ArrowRightDarkMode_svgSize);
-    const std::unique_ptr<Drawable> dmArrowUpSvg = Drawable::createFromImageData(BinaryData::ArrowUpDarkMode_svg, BinaryData::ArrowUpDarkMode_svgSize);
-
-    const std::unique_ptr<Drawable> blankSvg = Drawable::createFromImageData(BinaryData::Blank_svg, BinaryData::Blank_svgSize);
+    SharedResourcePointer<SharedResources> resources;
 
     Drawable* staffSvg = nullptr;
     Drawable* noteSvg = nullptr;
@@ -486,9 +1018,7 @@ private:
     Drawable* arrowUpSvg = nullptr;
     Drawable* sharpSvg = nullptr;
     Drawable* flatSvg = nullptr;
-    Drawable* naturalSvg = nullptr;
     Drawable* doubleSharpSvg = nullptr;
-    Drawable* doubleFlatSvg = nullptr;
 
     ComboBox keyMenu;
     TextButton notationButton;
@@ -499,10 +1029,19 @@ private:
     OctaveSlider octaveSlider;
 
     PluginModel* pluginModel;
-    Keys keys;
+    PluginSettings settings; //the editor's copy, refreshed in onParametersChanged
+    const Keys& keys = resources->getKeys();
     Chords chords;
     std::set<int> midiNotes;
     Chord chord;
+    uint32 noteShownUntil[128] = {}; //millisecond counter until which a short note is kept on screen
+    static constexpr uint32 minimumNoteDisplayMs = 120;
+    bool hasShortNotes = false;
+    NoteMask shownNotes;
+    uint32 lastMidiChangeCount = 0;
+    int64 numCoalescedMidiUpdates = 0;
+    String cachedChordName; //name of the chord above, only rebuilt when the chord or the notation changes
+    int cachedChordNameId = -1;
 
     TooltipWindow tooltipWindow{ this }; // instance required for ToolTips to work
     CustomLookAndFeel darkLookAndFeel;
@@ -510,6 +1049,17 @@ private:
     CustomLookAndFeel customFontLookAndFeel;
 
     FadeOut chordFadeOut;
+    ChordTextCache chordTextCache;
+    StaffCalculator staffCalculator { Rectangle<int>() }; //geometry for the current bounds, rebuilt in resized()
+    Image staffLayer; //staff and key signature, only redrawn on size, key or theme changes
+    float staffLayerScale = 0;
+    GlyphAtlas glyphAtlas;
+    NotationLayoutCache notationLayoutCache;
+    const NotationLayout* notationLayout = nullptr; //from the cache, only looked up again when notationLayoutDirty is set
+    bool notationLayoutDirty = true; //set whenever the notes, key, transposition or size change
+
+    //the note state is pulled once per display refresh, declared last so that it's the first thing to go
+    VBlankAttachment vBlankAttachment { this, [this] { onVBlank(); } };
 };
 
 static int getButtonHeight(Rectangle<int> bounds)
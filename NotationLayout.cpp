@@ -0,0 +1,235 @@
+/*
+  ==============================================================================
+
+   This file is part of the GrandStaffMIDIVisualizer plugin code.
+   Copyright (c) Brynjar Reynisson
+
+   The code included in this file is provided under the terms of the ISC license
+   http://www.isc.org/downloads/software-support-policy/isc-license. Permission
+   to use, copy, modify, and/or distribute this software for any purpose with or
+   without fee is hereby granted provided that the above copyright notice and
+   this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+   REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+   AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+   INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+   LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+   OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+   PERFORMANCE OF THIS SOFTWARE.
+
+  ==============================================================================
+*/
+
+#include "MainComponent.h"
+
+/*
+* 128 bits indexed by diatonic step. Offset so that every anchor note the transpose slider can produce fits,
+* even the ones transposed out of the midi range
+*/
+struct DiatonicMask
+{
+    static constexpr int stepOffset = 32;
+    uint64 bits[2] = { 0, 0 };
+
+    bool test(int diatonicStep) const
+    {
+        int bit = diatonicStep + stepOffset;
+        return (bits[bit >> 6] >> (bit & 63)) & 1;
+    }
+
+    void set(int diatonicStep)
+    {
+        int bit = diatonicStep + stepOffset;
+        bits[bit >> 6] |= (uint64)1 << (bit & 63);
+    }
+
+    //every step next to a step in this mask, i.e. a second away
+    DiatonicMask neighbors() const
+    {
+        DiatonicMask result;
+        result.bits[0] = (bits[0] << 1) | (bits[0] >> 1) | (bits[1] << 63);
+        result.bits[1] = (bits[1] << 1) | (bits[1] >> 1) | (bits[0] >> 63);
+        return result;
+    }
+};
+
+/*
+* Anchor notes on the staff are always natural notes. Only notes transposed out of the midi range
+* (which aren't drawn) can be left on an accented anchor, those share the step of the natural note below them
+*/
+static int getAnchorDiatonicStep(int anchorNote, bool& accented)
+{
+    static const int stepInOctave[] = { 0, 0, 1, 1, 2, 3, 3, 4, 4, 5, 5, 6 };
+    int octave = anchorNote >= 0 ? anchorNote / 12 : (anchorNote - 11) / 12;
+    int pitchClass = anchorNote - octave * 12;
+    accented = isAccentedPitchClass(pitchClass);
+    return (octave - 1) * 7 + stepInOctave[pitchClass];
+}
+
+/*
+* When notes are placed close to neighbor notes (e.g. E and F), one or more notes need to move to the right.
+* This method figures out how much to the right notes need to move (three places at most)
+*/
+void NotationLayout::resolveNeighborConflicts(const int* midiNotes, int numNotes, NoteDrawInfo* noteDrawInfos)
+{
+    /*
+    * Here we mark which diatonic steps are taken by an anchorNote (the actual graphical placement of the midi note),
+    * and which are taken more than once. For all double notes, move the second one of them, one place to the right.
+    */
+    DiatonicMask placed;
+    DiatonicMask placedAccented;
+    DiatonicMask doubled;
+    for (int i = 0; i < numNotes; i++)
+    {
+        NoteDrawInfo& noteDrawInfo = noteDrawInfos[midiNotes[i]];
+        bool accented;
+        int step = getAnchorDiatonicStep(noteDrawInfo.anchorNote, accented);
+        DiatonicMask& taken = accented ? placedAccented : placed;
+        if (taken.test(step))
+        {
+            if (!accented)
+                doubled.set(step);
+            noteDrawInfo.moveRight = 1;
+        }
+        else
+        {
+            taken.set(step);
+        }
+    }
+
+    /*
+    * We don't want to move notes that are over a staff line too much to the right,
+    * other notes (the ones between the lines, even steps from C0 to A5) will move as much to the right as needed.
+    */
+    DiatonicMask placedNeighbors = placed.neighbors();
+    DiatonicMask doubledNeighbors = doubled.neighbors();
+    for (int i = 0; i < numNotes; i++)
+    {
+        NoteDrawInfo& noteDrawInfo = noteDrawInfos[midiNotes[i]];
+        bool accented;
+        int step = getAnchorDiatonicStep(noteDrawInfo.anchorNote, accented);
+        if (!accented && step >= 0 && step <= 40 && step % 2 == 0)
+            noteDrawInfo.moveRight += doubledNeighbors.test(step) ? 2 : (placedNeighbors.test(step) ? 1 : 0);
+    }
+}
+
+void NotationLayout::build(const NoteMask& notes, const Keys& keys, const Key& key, const Chord& chord, int transposeOctaves, const StaffCalculator& staffCalculator)
+{
+    elements.clear();
+
+    int midiNotes[128];
+    int numNotes = 0;
+    for (int midiNote = 0; midiNote < 128; midiNote++)
+        if (notes.test(midiNote))
+            midiNotes[numNotes++] = midiNote;
+
+    //Find out where to place the notes
+    NoteDrawInfo noteDrawInfos[128];
+    bool spellWithKey = key.name != Key::SHARPS && key.name != Key::FLATS;
+    for (int i = 0; i < numNotes; i++)
+    {
+        int midiNote = midiNotes[i];
+        if (spellWithKey)
+        {
+            keys.applyAnchorNoteAndAccents(midiNote, key, chord, noteDrawInfos[midiNote]);
+            staffCalculator.noteYPlacement(noteDrawInfos[midiNote].anchorNote, noteDrawInfos[midiNote], false, false, 12 * transposeOctaves);
+        }
+        else
+        {
+            staffCalculator.noteYPlacement(midiNote, noteDrawInfos[midiNote], key.name == Key::SHARPS, true, 12 * transposeOctaves);
+        }
+    }
+
+    resolveNeighborConflicts(midiNotes, numNotes, noteDrawInfos);
+
+    //Figure out flat/sharp indentation
+    AccidentalStacking::Accidental accidentals[128];
+    int numAccidentals = 0;
+    for (int i = 0; i < numNotes; i++)
+    {
+        if (AccidentalStacking::getAccidental(midiNotes[i], noteDrawInfos[midiNotes[i]], staffCalculator.noteHeight, accidentals[numAccidentals]))
+            numAccidentals++;
+    }
+    AccidentalStacking::stack(accidentals, numAccidentals);
+    for (int i = 0; i < numAccidentals; i++)
+        noteDrawInfos[accidentals[i].midiNote].accentIndent = accidentals[i].column;
+
+    //Done finding out where to put the notes and accents, now the same for everything that gets drawn
+    float noteWidth = staffCalculator.noteWidth;
+    float noteHeight = staffCalculator.noteHeight;
+    float lineThickness = staffCalculator.lineThickness;
+    baseNoteX = staffCalculator.x + (staffCalculator.staffHeight / 2) + (staffCalculator.staffHeight / 4) + noteWidth * 4;
+    int lineX = baseNoteX - lineThickness;
+    lowestNoteY = numNotes > 0 ? noteDrawInfos[midiNotes[0]].y : 0;
+
+    for (int i = 0; i < numNotes; i++)
+    {
+        const NoteDrawInfo& noteDrawInfo = noteDrawInfos[midiNotes[i]];
+        float noteX = baseNoteX + noteWidth * noteDrawInfo.moveRight - lineThickness * noteDrawInfo.moveRight * 2;
+        float accentX = baseNoteX - noteWidth - (noteDrawInfo.accentIndent * noteWidth * 0.75);
+        elements.push_back({ glyph, GlyphAtlas::noteHead, 0, noteX, noteDrawInfo.y - lineThickness * 2, 0, 0 });
+
+        for (int j = 0; j < noteDrawInfo.lineCount; j++)
+            elements.push_back({ ledgerLine, GlyphAtlas::noteHead, 0, (float)lineX, noteDrawInfo.linePositions[j], noteWidth + lineThickness * 2, lineThickness });
+
+        if (noteDrawInfo.ottava != 0)
+        {
+            //above the note when it's played higher than drawn, below when it's played lower, away from its ledger lines
+            float labelHeight = noteHeight * 1.2f;
+            float labelY = noteDrawInfo.ottava > 0 ?
+                noteDrawInfo.y - labelHeight - noteHeight * 0.25f :
+                noteDrawInfo.y + noteHeight * 1.25f;
+            elements.push_back({ ottavaLabel, GlyphAtlas::noteHead, noteDrawInfo.ottava, noteX - noteWidth * 0.5f, labelY, noteWidth * 2, labelHeight });
+        }
+
+        if (noteDrawInfo.sharp)
+            elements.push_back({ glyph, GlyphAtlas::sharp, 0, accentX, noteDrawInfo.y - noteHeight * 0.75f, 0, 0 });
+        else if (noteDrawInfo.flat)
+            elements.push_back({ glyph, GlyphAtlas::flat, 0, accentX, noteDrawInfo.y - noteHeight * 1.25f, 0, 0 });
+        else if (noteDrawInfo.natural)
+            elements.push_back({ glyph, GlyphAtlas::natural, 0, accentX, noteDrawInfo.y - noteHeight * 0.75f, 0, 0 });
+        else if (noteDrawInfo.doubleSharp)
+            elements.push_back({ glyph, GlyphAtlas::doubleSharp, 0, accentX, noteDrawInfo.y, 0, 0 });
+        else if (noteDrawInfo.doubleFlat)
+            elements.push_back({ glyph, GlyphAtlas::doubleFlat, 0, accentX, noteDrawInfo.y - noteHeight * 1.25f, 0, 0 });
+    }
+    hasNotes = numNotes > 0;
+}
+
+const NotationLayout& NotationLayoutCache::get(const NoteMask& notes, const Keys& keys, int keyId, const Chord& chord, int transposeOctaves,
+    const StaffCalculator& staffCalculator)
+{
+    useCount++;
+    int chordId = chord.getId();
+    Entry* leastRecentlyUsed = &entries[0];
+    for (Entry& entry : entries)
+    {
+        if (entry.used && entry.notes == notes && entry.keyId == keyId && entry.chordId == chordId && entry.transposeOctaves == transposeOctaves)
+        {
+            numHits++;
+            entry.lastUsed = useCount;
+            return entry.layout;
+        }
+        if (!entry.used || (leastRecentlyUsed->used && (int32)(entry.lastUsed - leastRecentlyUsed->lastUsed) < 0))
+            leastRecentlyUsed = &entry;
+    }
+
+    //the evicted layout keeps its element storage, so after warming up nothing is allocated here either
+    numMisses++;
+    Entry& entry = *leastRecentlyUsed;
+    entry.layout.build(notes, keys, keys.getKey(keyId), chord, transposeOctaves, staffCalculator);
+    entry.notes = notes;
+    entry.keyId = keyId;
+    entry.chordId = chordId;
+    entry.transposeOctaves = transposeOctaves;
+    entry.lastUsed = useCount;
+    entry.used = true;
+    return entry.layout;
+}
+
+void NotationLayoutCache::clear()
+{
+    for (Entry& entry : entries)
+        entry.used = false;
+}
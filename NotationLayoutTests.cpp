@@ -0,0 +1,200 @@
+/*
+  ==============================================================================
+
+   This file is part of the GrandStaffMIDIVisualizer plugin code.
+   Copyright (c) Brynjar Reynisson
+
+   The code included in this file is provided under the terms of the ISC license
+   http://www.isc.org/downloads/software-support-policy/isc-license. Permission
+   to use, copy, modify, and/or distribute this software for any purpose with or
+   without fee is hereby granted provided that the above copyright notice and
+   this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+   REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+   AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+   INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+   LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+   OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+   PERFORMANCE OF THIS SOFTWARE.
+
+  ==============================================================================
+*/
+
+#include "MainComponent.h"
+
+#if JUCE_UNIT_TESTS
+
+/*
+* The map, set and note name version of resolveNeighborConflicts that NotationLayout used before the diatonic
+* step bitsets, kept here only to compare the two
+*/
+static void referenceResolveNeighborConflicts(std::set<int>& midiNotes, NoteDrawInfo* noteDrawInfos)
+{
+    static std::set<int> conflictLosers = {
+        12, 16, 19, 23, 26, 29,
+        33, 36, 40, 43, 47,
+        50, 53, 57, 60, 64,
+        67, 71, 74, 77, 81
+    };
+
+    std::map<int, int> noteCount;
+    for (int midiNote : midiNotes)
+    {
+        NoteDrawInfo& noteDrawInfo = noteDrawInfos[midiNote];
+        if (noteCount.find(noteDrawInfo.anchorNote) != noteCount.end())
+        {
+            noteCount[noteDrawInfo.anchorNote] = 2;
+            noteDrawInfo.moveRight = 1;
+        }
+        else
+        {
+            noteCount[noteDrawInfo.anchorNote] = 1;
+        }
+    }
+    for (int midiNote : midiNotes)
+    {
+        NoteDrawInfo& noteDrawInfo = noteDrawInfos[midiNote];
+        int cur = noteDrawInfo.anchorNote;
+        if (conflictLosers.find(cur) != conflictLosers.end())
+        {
+            int belowNeighbor = -1;
+            int aboveNeighbor = -1;
+            if (MidiMessage::getMidiNoteName(cur, true, false, 4) == "E" || MidiMessage::getMidiNoteName(cur, true, false, 4) == "B")
+            {
+                belowNeighbor = cur - 2;
+                aboveNeighbor = cur + 1;
+            }
+            else if (MidiMessage::getMidiNoteName(cur, true, false, 4) == "F" || MidiMessage::getMidiNoteName(cur, true, false, 4) == "C")
+            {
+                belowNeighbor = cur - 1;
+                aboveNeighbor = cur + 2;
+            }
+            else
+            {
+                belowNeighbor = cur - 2;
+                aboveNeighbor = cur + 2;
+            }
+            int neighborCount = 0;
+            if (noteCount.find(belowNeighbor) != noteCount.end())
+            {
+                neighborCount = noteCount[belowNeighbor];
+            }
+            if (noteCount.find(aboveNeighbor) != noteCount.end())
+            {
+                neighborCount = noteCount[aboveNeighbor] > neighborCount ? noteCount[aboveNeighbor] : neighborCount;
+            }
+            noteDrawInfo.moveRight += neighborCount;
+        }
+    }
+}
+
+class NotationLayoutTests final : public UnitTest
+{
+public:
+    NotationLayoutTests() : UnitTest("NotationLayout", "GrandStaffMIDIVisualizer") {}
+
+    void runTest() override
+    {
+        Keys keys;
+        StaffCalculator staffCalculator(Rectangle<int>(0, 0, 800, 600));
+        const int keyIds[] = { keys.getKeyIndex(Key::SHARPS), keys.getKeyIndex(Key::FLATS), keys.getKeyIndex("C"), keys.getKeyIndex("Gb") };
+
+        beginTest("moveRight matches the reference for every subset of octave wide windows");
+        int numSets = 0;
+        int numMismatches = 0;
+        for (int keyId : keyIds)
+        {
+            const Key& key = keys.getKey(keyId);
+            for (int transposeOctaves = -3; transposeOctaves <= 3; transposeOctaves++)
+            {
+                //anchors don't depend on the other notes, so they are worked out once per key and transposition
+                NoteDrawInfo anchors[128];
+                for (int midiNote = 0; midiNote < 128; midiNote++)
+                    placeNote(keys, key, staffCalculator, midiNote, transposeOctaves, anchors[midiNote]);
+
+                for (int lowest = 0; lowest + windowSize <= 128; lowest += windowSize / 2)
+                {
+                    for (int subset = 1; subset < (1 << windowSize); subset++)
+                    {
+                        int midiNotes[windowSize];
+                        int numNotes = 0;
+                        for (int i = 0; i < windowSize; i++)
+                            if ((subset >> i) & 1)
+                                midiNotes[numNotes++] = lowest + i;
+                        numMismatches += compare(midiNotes, numNotes, anchors) ? 0 : 1;
+                        numSets++;
+                    }
+                }
+            }
+        }
+        expectEquals(numMismatches, 0, "mismatches in " + String(numSets) + " note sets");
+
+        beginTest("moveRight matches the reference for random anchors");
+        //duplicates, accented anchors and anchors transposed out of the midi range, as the transpose slider can leave them
+        Random random = getRandom();
+        numMismatches = 0;
+        for (int run = 0; run < numRandomSets; run++)
+        {
+            NoteDrawInfo anchors[128];
+            int midiNotes[16];
+            int numNotes = 1 + random.nextInt(16);
+            for (int i = 0; i < numNotes; i++)
+            {
+                midiNotes[i] = i * 8 + random.nextInt(8);
+                anchors[midiNotes[i]].anchorNote = random.nextInt(32) + (random.nextInt(7) - 1) * 24;
+            }
+            numMismatches += compare(midiNotes, numNotes, anchors) ? 0 : 1;
+        }
+        expectEquals(numMismatches, 0, "mismatches in random note sets");
+    }
+
+private:
+    static constexpr int windowSize = 12; //windows overlap by half, so every pair of notes up to a tritone apart shares one
+    static constexpr int numRandomSets = 200000;
+
+    //the same placement NotationLayout::build does before resolving conflicts
+    static void placeNote(const Keys& keys, const Key& key, const StaffCalculator& staffCalculator, int midiNote, int transposeOctaves,
+        NoteDrawInfo& noteDrawInfo)
+    {
+        if (key.name != Key::SHARPS && key.name != Key::FLATS)
+        {
+            keys.applyAnchorNoteAndAccents(midiNote, key, nullChord, noteDrawInfo);
+            staffCalculator.noteYPlacement(noteDrawInfo.anchorNote, noteDrawInfo, false, false, 12 * transposeOctaves);
+        }
+        else
+        {
+            staffCalculator.noteYPlacement(midiNote, noteDrawInfo, key.name == Key::SHARPS, true, 12 * transposeOctaves);
+        }
+    }
+
+    //midiNotes are ascending, as both versions expect
+    bool compare(const int* midiNotes, int numNotes, const NoteDrawInfo* anchors)
+    {
+        std::set<int> noteSet;
+        for (int i = 0; i < numNotes; i++)
+        {
+            int midiNote = midiNotes[i];
+            expected[midiNote].anchorNote = actual[midiNote].anchorNote = anchors[midiNote].anchorNote;
+            expected[midiNote].moveRight = actual[midiNote].moveRight = 0;
+            noteSet.insert(midiNote);
+        }
+
+        referenceResolveNeighborConflicts(noteSet, expected);
+        NotationLayout::resolveNeighborConflicts(midiNotes, numNotes, actual);
+        for (int i = 0; i < numNotes; i++)
+        {
+            if (expected[midiNotes[i]].moveRight != actual[midiNotes[i]].moveRight)
+                return false;
+        }
+        return true;
+    }
+
+    //only the notes being compared are reset, the rest is left over from earlier sets
+    NoteDrawInfo expected[128];
+    NoteDrawInfo actual[128];
+};
+
+static NotationLayoutTests notationLayoutTests;
+
+#endif
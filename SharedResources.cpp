@@ -0,0 +1,84 @@
+/*
+  ==============================================================================
+
+   This file is part of the GrandStaffMIDIVisualizer plugin code.
+   Copyright (c) Brynjar Reynisson
+
+   The code included in this file is provided under the terms of the ISC license
+   http://www.isc.org/downloads/software-support-policy/isc-license. Permission
+   to use, copy, modify, and/or distribute this software for any purpose with or
+   without fee is hereby granted provided that the above copyright notice and
+   this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+   REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+   AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+   INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+   LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+   OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+   PERFORMANCE OF THIS SOFTWARE.
+
+  ==============================================================================
+*/
+
+#include "MainComponent.h"
+
+struct SvgData
+{
+    const char* data;
+    int size;
+};
+//in DrawableId order, light and then dark
+static const SvgData themeSvgs[2][SharedResources::numDrawables] =
+{
+    {
+        { BinaryData::Grand_staff_02_svg, BinaryData::Grand_staff_02_svgSize },
+        { BinaryData::Whole_note_svg, BinaryData::Whole_note_svgSize },
+        { BinaryData::Increment_Symbol_svg, BinaryData::Increment_Symbol_svgSize },
+        { BinaryData::Sharp_svg, BinaryData::Sharp_svgSize },
+        { BinaryData::Flat_svg, BinaryData::Flat_svgSize },
+        { BinaryData::Natural_svg, BinaryData::Natural_svgSize },
+        { BinaryData::DoubleSharp_svg, BinaryData::DoubleSharp_svgSize },
+        { BinaryData::DoubleFlat_svg, BinaryData::DoubleFlat_svgSize },
+        { BinaryData::ArrowDown_svg, BinaryData::ArrowDown_svgSize },
+        { BinaryData::ArrowRight_svg, BinaryData::ArrowRight_svgSize },
+        { BinaryData::ArrowUp_svg, BinaryData::ArrowUp_svgSize }
+    },
+    {
+        { BinaryData::Dark_Mode_Grand_Staff_svg, BinaryData::Dark_Mode_Grand_Staff_svgSize },
+        { BinaryData::Dark_Mode_Whole_Note_svg, BinaryData::Dark_Mode_Whole_Note_svgSize },
+        { BinaryData::Dark_Mode_Increment_Symbol_svg, BinaryData::Dark_Mode_Increment_Symbol_svgSize },
+        { BinaryData::Dark_Mode_Sharp_svg, BinaryData::Dark_Mode_Sharp_svgSize },
+        { BinaryData::Dark_Mode_Flat_svg, BinaryData::Dark_Mode_Flat_svgSize },
+        { BinaryData::Dark_Mode_Natural_svg, BinaryData::Dark_Mode_Natural_svgSize },
+        { BinaryData::Dark_Mode_Double_Sharp_svg, BinaryData::Dark_Mode_Double_Sharp_svgSize },
+        { BinaryData::Dark_Mode_Double_Flat_svg, BinaryData::Dark_Mode_Double_Flat_svgSize },
+        { BinaryData::ArrowDownDarkMode_svg, BinaryData::ArrowDownDarkMode_svgSize },
+        { BinaryData::ArrowRightDarkMode_svg, BinaryData::ArrowRightDarkMode_svgSize },
+        { BinaryData::ArrowUpDarkMode_svg, BinaryData::ArrowUpDarkMode_svgSize }
+    }
+};
+
+SharedResources::SharedResources() :
+    typeface(Typeface::createSystemTypefaceFor(BinaryData::consola_ttf, BinaryData::consola_ttfSize)),
+    plainFont(Font(typeface).withTypefaceStyle("Plain")),
+    boldFont(Font(typeface).withTypefaceStyle("Bold"))
+{
+    blank = Drawable::createFromImageData(BinaryData::Blank_svg, BinaryData::Blank_svgSize);
+}
+
+Drawable* SharedResources::getDrawable(DrawableId id, bool darkMode)
+{
+    int theme = darkMode ? 1 : 0;
+    if (!themeLoaded[theme])
+        loadTheme(theme);
+    return drawables[theme][id].get();
+}
+
+//parsing the svgs is most of the work of opening the first editor, so a theme waits until something asks for it
+void SharedResources::loadTheme(int theme)
+{
+    for (int id = 0; id < numDrawables; id++)
+        drawables[theme][id] = Drawable::createFromImageData(themeSvgs[theme][id].data, (size_t)themeSvgs[theme][id].size);
+    themeLoaded[theme] = true;
+}
\ No newline at end of file
@@ -47,28 +47,8 @@ StaffCalculator::StaffCalculator(Rectangle<int> bounds)
     f4Anchor = y + staffYIncrement + (1 * noteHeight) - lineThickness * 1.5;
     e3Anchor = f4Anchor + (4 * noteHeight) - lineThickness;
 
-    g5 = f4Anchor - (4 * noteHeight * noteMultiplyConstant);
-    e5 = f4Anchor - (3 * noteHeight * noteMultiplyConstant);
-    c5 = f4Anchor - (2 * noteHeight * noteMultiplyConstant);
-    a4 = f4Anchor - (1 * noteHeight * noteMultiplyConstant);
-
     c3 = e3Anchor + (1 * noteHeight * noteMultiplyConstant);
 
-    e1 = g1Anchor + (1 * noteHeight);
-    c1 = g1Anchor + (2 * noteHeight);
-    a0 = g1Anchor + (3 * noteHeight);
-    f0 = g1Anchor + (4 * noteHeight);
-
-    gLine1 = a4 + (0.5 * noteHeight);
-    gLine2 = c5 + (0.5 * noteHeight);
-    gLine3 = e5 + (0.5 * noteHeight);
-    gLine4 = g5 + (0.5 * noteHeight);
-    c3Line = c3 + (0.5 * noteHeight);
-    fLine1 = e1 + (0.5 * noteHeight);
-    fLine2 = c1 + (0.5 * noteHeight);
-    fLine3 = a0 + (0.5 * noteHeight);
-    fLine4 = f0 + (0.5 * noteHeight);
-
     sharpFontSize = noteHeight * 1.5;
     flatFontSize = noteHeight * 1.5;
 
@@ -155,244 +135,130 @@ StaffCalculator::StaffCalculator(Rectangle<int> bounds)
     //Fb
     flatsX[12] = keyX + noteWidth * 3.8;
     flatsX[13] = keyX + noteWidth * 3.8;
-}
 
-static int accentedNotes[] = {
-    18, 20, 22,
-    25, 27, 30, 32, 34,
-    37, 39, 42, 44, 46,
-    49, 51, 54, 56, 58,
-    61, 63, 66, 68, 70,
-    73, 75, 78, 80, 82
-};
+    buildNotePlacements();
+}
 
-void StaffCalculator::noteYPlacement(int midiNote, NoteDrawInfo& noteDrawInfo, bool sharp, bool applySharpFlat, int transpose)
+float StaffCalculator::diatonicStepYPlacement(int diatonicStep) const
 {
-    float y = -500;
-    int drawnNote = midiNote + transpose;
-
-    for (int note : accentedNotes)
-    {
-        if (drawnNote == note && !(noteDrawInfo.anchorNote > 0))
-        {
-            int drawnAccentedNote = sharp ? drawnNote - 1 : drawnNote + 1;
-            noteYPlacement(drawnAccentedNote, noteDrawInfo, sharp, false, 0);
-            if (applySharpFlat)
-            {
-                if (sharp)
-                    noteDrawInfo.sharp = true;
-                else
-                    noteDrawInfo.flat = true;
-            }
-            return;
-        }
-    }
+    float halfStep = 0.5 * noteHeight;
+    float narrowHalfStep = 0.5 * noteHeight * noteMultiplyConstant;
 
-    float noteMultiplyConstant = 0.97;
-    if (drawnNote < 29)
+    if (diatonicStep < 10)
     {
         //below F1
-        switch (drawnNote)
-        {
-        case 16: //E0
-            y = f0 + (0.5 * noteHeight);
-            break;
-        case 17:
-            y = f0;
-            break;
-        case 19:
-            y = a0 + (0.5 * noteHeight);
-            break;
-        case 21:
-            y = a0;
-            break;
-        case 23:
-            y = c1 + (0.5 * noteHeight);
-            break;
-        case 24: //C1
-            y = c1;
-            break;
-        case 26:
-            y = e1 + (0.5 * noteHeight);
-            break;
-        case 28: //E1
-            y = e1;
-            break;
-        case 27:
-            y = e1 - (0.5 * noteHeight);
-            break;
-        }
-        if (drawnNote < 19)
-        {
-            noteDrawInfo.lineCount = 4;
-            noteDrawInfo.linePositions[0] = fLine1;
-            noteDrawInfo.linePositions[1] = fLine2;
-            noteDrawInfo.linePositions[2] = fLine3;
-            noteDrawInfo.linePositions[3] = fLine4;
-        }
-        else if (drawnNote < 23)
-        {
-            noteDrawInfo.lineCount = 3;
-            noteDrawInfo.linePositions[0] = fLine1;
-            noteDrawInfo.linePositions[1] = fLine2;
-            noteDrawInfo.linePositions[2] = fLine3;
-        }
-        else if (drawnNote < 26)
-        {
-            noteDrawInfo.lineCount = 2;
-            noteDrawInfo.linePositions[0] = fLine1;
-            noteDrawInfo.linePositions[1] = fLine2;
-        }
-        else if (drawnNote < 29)
-        {
-            noteDrawInfo.lineCount = 1;
-            noteDrawInfo.linePositions[0] = fLine1;
-        }
+        return g1Anchor + halfStep * (11 - diatonicStep);
     }
-    else if (drawnNote >= 29 && drawnNote < 48)
+    else if (diatonicStep < 21)
     {
         //F1 to B2
-        switch (drawnNote)
-        {
-        case 29:
-            y = g1Anchor + (0.5 * noteHeight * noteMultiplyConstant);
-            break;
-        case 31:
-            y = g1Anchor;
-            break;
-        case 33:
-            y = g1Anchor - (0.5 * noteHeight * noteMultiplyConstant);
-            break;
-        case 35:
-            y = g1Anchor - (1 * noteHeight * noteMultiplyConstant);
-            break;
-        case 36: //C2
-            y = g1Anchor - (1.5 * noteHeight * noteMultiplyConstant);
-            break;
-        case 38:
-            y = g1Anchor - (2 * noteHeight * noteMultiplyConstant);
-            break;
-        case 40:
-            y = g1Anchor - (2.5 * noteHeight * noteMultiplyConstant);
-            break;
-        case 41:
-            y = g1Anchor - (3 * noteHeight * noteMultiplyConstant);
-            break;
-        case 43:
-            y = g1Anchor - (3.5 * noteHeight * noteMultiplyConstant);
-            break;
-        case 45:
-            y = g1Anchor - (4 * noteHeight * noteMultiplyConstant);
-            break;
-        case 47:
-            y = g1Anchor - (4.5 * noteHeight * noteMultiplyConstant);
-            break;
-        }
+        return g1Anchor - narrowHalfStep * (diatonicStep - 11);
     }
-    else if (drawnNote == 48)
+    else if (diatonicStep == 21)
     {
-        y = c3;
-        noteDrawInfo.lineCount = 1;
-        noteDrawInfo.linePositions[0] = c3Line;
+        return c3;
     }
-    else if (drawnNote > 48 && drawnNote <= 65)
+    else if (diatonicStep < 27)
     {
-        //D3 to F4
-        switch (drawnNote)
-        {
-        case 50:
-            y = e3Anchor + (0.5 * noteHeight * noteMultiplyConstant);
-            break;
-        case 52:
-            y = e3Anchor;
-            break;
-        case 53:
-            y = e3Anchor - (0.5 * noteHeight * noteMultiplyConstant);
-            break;
-        case 55:
-            y = e3Anchor - (1 * noteHeight * noteMultiplyConstant);
-            break;
-        case 57:
-            y = e3Anchor - (1.5 * noteHeight * noteMultiplyConstant);
-            break;
-        case 59:
-            y = f4Anchor + (2 * noteHeight * noteMultiplyConstant);
-            break;
-        case 60: // C4
-            y = f4Anchor + (1.5 * noteHeight * noteMultiplyConstant);
-            break;
-        case 62:
-            y = f4Anchor + (1 * noteHeight * noteMultiplyConstant);
-            break;
-        case 64:
-            y = f4Anchor + (0.5 * noteHeight * noteMultiplyConstant);
-            break;
-        case 65:
-            y = f4Anchor;
-            break;
-        }
+        //D3 to A3
+        return e3Anchor - narrowHalfStep * (diatonicStep - 23);
     }
-    else if (drawnNote > 65)
+    else if (diatonicStep <= 31)
     {
-        //G4 to A5
-        switch (drawnNote)
-        {
-        case 67:
-            y = f4Anchor - (0.5 * noteHeight);
-            break;
-        case 69:
-            y = a4;
-            break;
-        case 71:
-            y = a4 - (0.5 * noteHeight);
-            break;
-        case 72: //C5
-            y = c5;
-            break;
-        case 74:
-            y = c5 - (0.5 * noteHeight);
-            break;
-        case 76:
-            y = e5;
-            break;
-        case 77:
-            y = e5 - (0.5 * noteHeight);
-            break;
-        case 79:
-            y = g5;
-            break;
-        case 81:
-            y = g5 - (0.5 * noteHeight);
-            break;
-        }
-        if (drawnNote > 77 && drawnNote < 82)
-        {
-            noteDrawInfo.lineCount = 4;
-            noteDrawInfo.linePositions[0] = gLine1;
-            noteDrawInfo.linePositions[1] = gLine2;
-            noteDrawInfo.linePositions[2] = gLine3;
-            noteDrawInfo.linePositions[3] = gLine4;
-        }
-        else if (drawnNote > 74 && drawnNote < 78)
+        //B3 to F4
+        return f4Anchor + narrowHalfStep * (31 - diatonicStep);
+    }
+
+    //above F4 the lines are narrow steps apart and each space is half a note height above its line
+    int stepsAboveF4 = diatonicStep - 31;
+    return f4Anchor - narrowHalfStep * 2 * (stepsAboveF4 / 2) - (stepsAboveF4 % 2 == 1 ? halfStep : 0);
+}
+
+int StaffCalculator::getDiatonicStep(int midiNote)
+{
+    //accented notes get the step of the natural note below them
+    static const int stepInOctave[] = { 0, 0, 1, 1, 2, 3, 3, 4, 4, 5, 5, 6 };
+    return (midiNote / 12 - 1) * 7 + stepInOctave[midiNote % 12];
+}
+
+int StaffCalculator::getLedgerLineCount(int diatonicStep)
+{
+    if (diatonicStep <= 9)
+        return (9 - diatonicStep) / 2 + 1; //below the F-clef, starting at E1
+    else if (diatonicStep == 21)
+        return 1; //C3 between the clefs
+    else if (diatonicStep >= 33)
+        return (diatonicStep - 33) / 2 + 1; //above the G-clef, starting at A4
+    return 0;
+}
+
+void StaffCalculator::buildNotePlacements()
+{
+    for (int i = 0; i < numDiatonicSteps; i++)
+        diatonicStepY[i] = diatonicStepYPlacement(lowestDiatonicStep + i);
+
+    for (int midiNote = 0; midiNote < 128; midiNote++)
+    {
+        NotePlacement& placement = notePlacements[midiNote];
+        placement.diatonicStep = getDiatonicStep(midiNote);
+
+        //move notes far off the staff an octave at a time, at most 15ma/15mb
+        int drawnStep = placement.diatonicStep;
+        placement.ottava = 0;
+        while (getLedgerLineCount(drawnStep) > maxLedgerLines && drawnStep >= 33 && placement.ottava < 2)
         {
-            noteDrawInfo.lineCount = 3;
-            noteDrawInfo.linePositions[0] = gLine1;
-            noteDrawInfo.linePositions[1] = gLine2;
-            noteDrawInfo.linePositions[2] = gLine3;
+            drawnStep -= 7;
+            placement.ottava++;
         }
-        else if (drawnNote > 71 && drawnNote < 75)
+        while (getLedgerLineCount(drawnStep) > maxLedgerLines && drawnStep <= 9 && placement.ottava > -2)
         {
-            noteDrawInfo.lineCount = 2;
-            noteDrawInfo.linePositions[0] = gLine1;
-            noteDrawInfo.linePositions[1] = gLine2;
+            drawnStep += 7;
+            placement.ottava--;
         }
-        else if (drawnNote > 67 && drawnNote < 72)
+
+        placement.y = diatonicStepY[drawnStep - lowestDiatonicStep];
+        placement.lineCount = getLedgerLineCount(drawnStep);
+        placement.firstLineStep = drawnStep <= 9 ? 9 : (drawnStep == 21 ? 21 : 33);
+        placement.lineStepDirection = drawnStep <= 9 ? -2 : 2;
+    }
+}
+
+void StaffCalculator::noteYPlacement(int midiNote, NoteDrawInfo& noteDrawInfo, bool sharp, bool applySharpFlat, int transpose) const
+{
+    int drawnNote = midiNote + transpose;
+
+    if (drawnNote >= 0 && drawnNote < 128 && isAccentedPitchClass(drawnNote % 12) && !(noteDrawInfo.anchorNote > 0))
+    {
+        //accented notes without an anchor are drawn on the natural note next to them
+        drawnNote = sharp ? drawnNote - 1 : drawnNote + 1;
+        if (applySharpFlat)
         {
-            noteDrawInfo.lineCount = 1;
-            noteDrawInfo.linePositions[0] = gLine1;
+            if (sharp)
+                noteDrawInfo.sharp = true;
+            else
+                noteDrawInfo.flat = true;
         }
     }
 
     noteDrawInfo.anchorNote = drawnNote;
-    noteDrawInfo.y = y;
-}
\ No newline at end of file
+    noteDrawInfo.ottava = 0;
+    if (drawnNote < 0 || drawnNote >= 128)
+    {
+        //transposed out of midi range
+        noteDrawInfo.y = -500;
+        noteDrawInfo.lineCount = 0;
+        return;
+    }
+
+    const NotePlacement& placement = notePlacements[drawnNote];
+    //the anchor is where the note ends up on the staff, so that neighbour conflicts are resolved where it's drawn
+    noteDrawInfo.anchorNote = drawnNote - placement.ottava * 12;
+    noteDrawInfo.ottava = placement.ottava;
+    noteDrawInfo.y = placement.y;
+    noteDrawInfo.lineCount = placement.lineCount;
+    for (int i = 0; i < placement.lineCount; i++)
+    {
+        int lineStep = placement.firstLineStep + i * placement.lineStepDirection;
+        noteDrawInfo.linePositions[i] = diatonicStepY[lineStep - lowestDiatonicStep] + (0.5 * noteHeight);
+    }
+}
@@ -0,0 +1,104 @@
+/*
+  ==============================================================================
+
+   This file is part of the GrandStaffMIDIVisualizer plugin code.
+   Copyright (c) Brynjar Reynisson
+
+   The code included in this file is provided under the terms of the ISC license
+   http://www.isc.org/downloads/software-support-policy/isc-license. Permission
+   to use, copy, modify, and/or distribute this software for any purpose with or
+   without fee is hereby granted provided that the above copyright notice and
+   this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+   REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+   AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+   INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+   LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+   OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+   PERFORMANCE OF THIS SOFTWARE.
+
+  ==============================================================================
+*/
+
+#include "MainComponent.h"
+
+#if JUCE_UNIT_TESTS
+
+/*
+* paint() used to build a StaffCalculator every frame, now it reads the one resized() keeps. The first test checks
+* that the kept one follows the component's size, the second times both ways and only logs the numbers
+*/
+class StaffCalculatorTests final : public UnitTest
+{
+public:
+    StaffCalculatorTests() : UnitTest("StaffCalculator", "GrandStaffMIDIVisualizer") {}
+
+    void runTest() override
+    {
+        beginTest("resized() keeps the staff geometry in step with the component's size");
+        PluginModel pluginModel;
+        MainComponent mainComponent(&pluginModel);
+        const int sizes[][2] = { { 500, 500 }, { 800, 600 }, { 1200, 400 }, { 300, 900 } };
+        for (auto& size : sizes)
+        {
+            mainComponent.setSize(size[0], size[1]);
+            StaffCalculator expected(Rectangle<int>(0, 0, size[0], size[1]));
+            expect(isSameGeometry(mainComponent.getStaffCalculator(), expected),
+                "geometry after resizing to " + String(size[0]) + "x" + String(size[1]));
+            expectEquals(pluginModel.uiWidth.load(), size[0]);
+            expectEquals(pluginModel.uiHeight.load(), size[1]);
+        }
+
+        beginTest("Layout cost per frame, before and after");
+        const StaffCalculator& member = mainComponent.getStaffCalculator();
+        constexpr int numFrames = 100000;
+        volatile float sink = 0;
+
+        int64 start = Time::getHighResolutionTicks();
+        for (int frame = 0; frame < numFrames; frame++)
+        {
+            //before, the height changes so that the construction can't be hoisted out of the loop
+            StaffCalculator staffCalculator(Rectangle<int>(0, 0, 800, 600 + (frame & 1)));
+            sink = sink + staffCalculator.g1Anchor;
+        }
+        double beforeNs = Time::highResolutionTicksToSeconds(Time::getHighResolutionTicks() - start) * 1.0e9 / numFrames;
+
+        start = Time::getHighResolutionTicks();
+        for (int frame = 0; frame < numFrames; frame++)
+        {
+            const StaffCalculator& staffCalculator = member;
+            sink = sink + staffCalculator.g1Anchor;
+        }
+        double afterNs = Time::highResolutionTicksToSeconds(Time::getHighResolutionTicks() - start) * 1.0e9 / numFrames;
+
+        //timings depend on the build and the machine, so they are only logged
+        logMessage("StaffCalculator per frame: " + String(beforeNs, 1) + " ns built in paint, " + String(afterNs, 1) + " ns kept as a member");
+    }
+
+private:
+    static bool isSameGeometry(const StaffCalculator& actual, const StaffCalculator& expected)
+    {
+        if (actual.noteWidth != expected.noteWidth || actual.noteHeight != expected.noteHeight || actual.lineThickness != expected.lineThickness ||
+            actual.g1Anchor != expected.g1Anchor || actual.a2Anchor != expected.a2Anchor || actual.e3Anchor != expected.e3Anchor ||
+            actual.f4Anchor != expected.f4Anchor || actual.width != expected.width || actual.height != expected.height)
+            return false;
+        if (!std::equal(std::begin(actual.sharpsY), std::end(actual.sharpsY), std::begin(expected.sharpsY)) ||
+            !std::equal(std::begin(actual.flatsY), std::end(actual.flatsY), std::begin(expected.flatsY)))
+            return false;
+
+        for (int midiNote = 0; midiNote < 128; midiNote++)
+        {
+            NoteDrawInfo actualNote, expectedNote;
+            actual.noteYPlacement(midiNote, actualNote);
+            expected.noteYPlacement(midiNote, expectedNote);
+            if (actualNote.y != expectedNote.y || actualNote.lineCount != expectedNote.lineCount || actualNote.ottava != expectedNote.ottava)
+                return false;
+        }
+        return true;
+    }
+};
+
+static StaffCalculatorTests staffCalculatorTests;
+
+#endif
@@ -0,0 +1,43 @@
+/*
+  ==============================================================================
+
+   This file is part of the GrandStaffMIDIVisualizer plugin code.
+   Copyright (c) Brynjar Reynisson
+
+   The code included in this file is provided under the terms of the ISC license
+   http://www.isc.org/downloads/software-support-policy/isc-license. Permission
+   to use, copy, modify, and/or distribute this software for any purpose with or
+   without fee is hereby granted provided that the above copyright notice and
+   this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH
+   REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+   AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT,
+   INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+   LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR
+   OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+   PERFORMANCE OF THIS SOFTWARE.
+
+  ==============================================================================
+*/
+
+#include "MainComponent.h"
+
+/*
+* Entry point of the GrandStaffMIDIVisualizerTests console app, which runs the unit tests and benchmarks in the
+* *Tests.cpp files. The exit code is the number of failed tests, so that it can be used from a script
+*/
+int main()
+{
+    //some of the tests create components
+    ScopedJuceInitialiser_GUI juceInitialiser;
+
+    UnitTestRunner runner;
+    runner.setAssertOnFailure(false);
+    runner.runTestsInCategory("GrandStaffMIDIVisualizer");
+
+    int numFailures = 0;
+    for (int i = 0; i < runner.getNumResults(); i++)
+        numFailures += runner.getResult(i)->failures;
+    return numFailures;
+}
@@ -23,12 +23,25 @@
 
 #include "VSTParameters.h"
 
+/*
+* The key ids, in the order Keys adds them. Saved sessions store the id and keep their key, but host automation stores
+* the normalised value, which moved when the choices grew from the original 16 keys to 35. Automation of the key
+* recorded before that plays back as a different key
+*/
+static StringArray getKeyChoices()
+{
+    StringArray keyChoices;
+    for (const String& keyName : Keys().getKeyNames())
+        keyChoices.add(keyName);
+    return keyChoices;
+}
+
 VSTParameters::VSTParameters(AudioProcessor& processorRef, PluginModel& pluginModelRef) :
     processor (processorRef),
     pluginModel (pluginModelRef),
     parameters(processor, nullptr, juce::Identifier("GrandStaffMIDIVisualizerParameters"),
         {
-                std::make_unique<juce::AudioParameterChoice>(KEY, "Key", StringArray { "C", "C#", "Db", "D", "Eb", "E", "F", "F#", "Gb", "G", "Ab", "A", "Bb", "B", "Sharps", "Flats" }, 0),
+                std::make_unique<juce::AudioParameterChoice>(KEY, "Key", getKeyChoices(), 0),
                 std::make_unique<juce::AudioParameterBool>(HOLD_NOTES, "Hold Notes", false),
                 std::make_unique<juce::AudioParameterInt>(OCTAVES, "Octaves", -3, 3, 0),
                 std::make_unique<juce::AudioParameterBool>(SHORT_NOTATION, "Display chords with short notation", false),
@@ -38,21 +51,13 @@ VSTParameters::VSTParameters(AudioProcessor& processorRef, PluginModel& pluginMo
         }
         )
 {
-    keyParameter = (AudioParameterChoice*)parameters.getParameter(KEY);
-    holdNotesParameter = parameters.getRawParameterValue(HOLD_NOTES);
-    octavesParameter = parameters.getRawParameterValue(OCTAVES);
-    shortNotationParameter = parameters.getRawParameterValue(SHORT_NOTATION);
-    chordPlacementParameter = parameters.getRawParameterValue(CHORD_PLACEMENT);
-    chordFontBoldParameter = parameters.getRawParameterValue(CHORD_FONT_BOLD);
-    darkModeParameter = parameters.getRawParameterValue(DARK_MODE);
-
-    parameters.addParameterListener(KEY, this);
-    parameters.addParameterListener(HOLD_NOTES, this);
-    parameters.addParameterListener(OCTAVES, this);
-    parameters.addParameterListener(SHORT_NOTATION, this);
-    parameters.addParameterListener(CHORD_PLACEMENT, this);
-    parameters.addParameterListener(CHORD_FONT_BOLD, this);
-    parameters.addParameterListener(DARK_MODE, this);
+    static const String* const parameterIds[numParameters] = { &KEY, &HOLD_NOTES, &OCTAVES, &SHORT_NOTATION, &CHORD_PLACEMENT, &CHORD_FONT_BOLD, &DARK_MODE };
+    for (int index = 0; index < numParameters; index++)
+    {
+        parameterSlots[index] = parameters.getParameter(*parameterIds[index]);
+        jassert(parameterSlots[index]->getParameterIndex() == index);
+        parameterSlots[index]->addListener(this);
+    }
 
     pluginModel.paramChangedFromUI = [&] { pluginModelChangedFromUI(); };
 }
@@ -60,115 +65,160 @@ VSTParameters::VSTParameters(AudioProcessor& processorRef, PluginModel& pluginMo
 VSTParameters::~VSTParameters()
 {
     pluginModel.paramChangedFromUI = nullptr;
-    parameters.removeParameterListener(KEY, this);
-    parameters.removeParameterListener(HOLD_NOTES, this);
-    parameters.removeParameterListener(OCTAVES, this);
-    parameters.removeParameterListener(SHORT_NOTATION, this);
-    parameters.removeParameterListener(CHORD_PLACEMENT, this);
-    parameters.removeParameterListener(CHORD_FONT_BOLD, this);
-    parameters.removeParameterListener(DARK_MODE, this);
+    for (RangedAudioParameter* parameter : parameterSlots)
+        parameter->removeListener(this);
 }
 
-void VSTParameters::parameterChanged(const String& parameterID, float newValue)
+float VSTParameters::getParameterValue(int index) const
 {
-    if (parameterID == KEY.getCharPointer())
-        pluginModel.keyId = (int)*keyParameter;
-    else if (parameterID == HOLD_NOTES.getCharPointer())
-        pluginModel.holdNotes = *holdNotesParameter > 0.5;
-    else if (parameterID == OCTAVES.getCharPointer())
-        pluginModel.transposeOctaves = (int)*octavesParameter;
-    else if (parameterID == SHORT_NOTATION.getCharPointer())
-        pluginModel.shortNotation = *shortNotationParameter > 0.5;
-    else if (parameterID == CHORD_PLACEMENT.getCharPointer())
-        pluginModel.chordPlacement = (int)*chordPlacementParameter;
-    else if (parameterID == CHORD_FONT_BOLD.getCharPointer())
-        pluginModel.chordFontBold = *chordFontBoldParameter > 0.5;
-    else if (parameterID == DARK_MODE.getCharPointer())
-        pluginModel.darkMode = *darkModeParameter > 0.5;
+    return parameterSlots[index]->convertFrom0to1(parameterSlots[index]->getValue());
+}
 
-    pluginModel.hasParamChanges = true;
-    if (pluginModel.paramChangedFromHost != nullptr)
-        pluginModel.paramChangedFromHost();
+float VSTParameters::getSettingValue(const PluginSettings& settings, int index)
+{
+    switch (index)
+    {
+    case keyParameter:              return (float)settings.keyId;
+    case holdNotesParameter:        return settings.holdNotes ? 1.0f : 0.0f;
+    case octavesParameter:          return (float)settings.transposeOctaves;
+    case shortNotationParameter:    return settings.shortNotation ? 1.0f : 0.0f;
+    case chordPlacementParameter:   return (float)settings.chordPlacement;
+    case chordFontBoldParameter:    return settings.chordFontBold ? 1.0f : 0.0f;
+    case darkModeParameter:         return settings.darkMode ? 1.0f : 0.0f;
+    default:                        return 0.0f;
+    }
 }
 
-void VSTParameters::pluginModelChangedFromUI()
+void VSTParameters::setSettingValue(PluginSettings& settings, int index, float value)
 {
-    *keyParameter = pluginModel.keyId;
-    *holdNotesParameter = pluginModel.holdNotes;
-    *octavesParameter = pluginModel.transposeOctaves;
-    *shortNotationParameter = pluginModel.shortNotation;
-    *chordPlacementParameter = pluginModel.chordPlacement;
-    *chordFontBoldParameter = pluginModel.chordFontBold;
-    *darkModeParameter = pluginModel.darkMode;
+    switch (index)
+    {
+    case keyParameter:              settings.keyId = (int8)value; break;
+    case holdNotesParameter:        settings.holdNotes = value > 0.5; break;
+    case octavesParameter:          settings.transposeOctaves = (int8)value; break;
+    case shortNotationParameter:    settings.shortNotation = value > 0.5; break;
+    case chordPlacementParameter:   settings.chordPlacement = (int8)value; break;
+    case chordFontBoldParameter:    settings.chordFontBold = value > 0.5; break;
+    case darkModeParameter:         settings.darkMode = value > 0.5; break;
+    default:                        break;
+    }
+}
 
-    Value holdNotes = parameters.getParameterAsValue(HOLD_NOTES);
-    holdNotes = pluginModel.holdNotes;
+//may be called before the value tree state has caught up, so the value is worked out from newValue
+void VSTParameters::parameterValueChanged(int parameterIndex, float newValue)
+{
+    if (parameterIndex < 0 || parameterIndex >= numParameters)
+        return;
 
-    Value octaves = parameters.getParameterAsValue(OCTAVES);
-    octaves = pluginModel.transposeOctaves;
+    float value = parameterSlots[parameterIndex]->convertFrom0to1(newValue);
+    bool changed = false;
+    pluginModel.updateSettings([&](PluginSettings& settings)
+    {
+        changed = getSettingValue(settings, parameterIndex) != value;
+        setSettingValue(settings, parameterIndex, value);
+    });
 
-    Value shortNotation = parameters.getParameterAsValue(SHORT_NOTATION);
-    shortNotation = pluginModel.shortNotation;
+    //the editor notices this on its next display refresh, echoes of its own changes aren't news to it
+    if (changed)
+        pluginModel.hasParamChanges = true;
+}
 
-    Value chordPlacement = parameters.getParameterAsValue(CHORD_PLACEMENT);
-    chordPlacement = pluginModel.chordPlacement;
+void VSTParameters::pluginModelChangedFromUI()
+{
+    //only the parameters the host doesn't already have are sent, each as its own gesture
+    const PluginSettings settings = pluginModel.getSettings();
+    uint32 dirtyParameters = 0;
+    for (int index = 0; index < numParameters; index++)
+    {
+        if (getParameterValue(index) != getSettingValue(settings, index))
+            dirtyParameters |= 1u << index;
+    }
 
-    Value chordFontBold = parameters.getParameterAsValue(CHORD_FONT_BOLD);
-    chordFontBold = pluginModel.chordFontBold;
+    for (int index = 0; index < numParameters; index++)
+    {
+        if ((dirtyParameters >> index & 1) == 0)
+            continue;
 
-    Value darkMode = parameters.getParameterAsValue(DARK_MODE);
-    darkMode = pluginModel.darkMode;
+        RangedAudioParameter* parameter = parameterSlots[index];
+        parameter->beginChangeGesture();
+        parameter->setValueNotifyingHost(parameter->convertTo0to1(getSettingValue(settings, index)));
+        parameter->endChangeGesture();
+    }
 
     pluginModel.hasUIChanges = false;
 }
 
-static juce::Identifier oldUiState("uiState");
 static juce::Identifier UIState("UIState");
 
+/*
+* The state is a fixed layout, little endian: a magic number and version, the number of parameters, each parameter's
+* value as a float and then the editor's width and height. Later versions may only add to the end. A state saved by a
+* later version than this one isn't loaded at all, the values it has can't be trusted to mean the same thing here.
+* Anything else is taken to be the XML state older versions saved
+*/
+static constexpr int stateMagic = 0x564d5347; //"GSMV"
+static constexpr int stateVersion = 1;
+static constexpr int stateHeaderSize = 8;
+
 void VSTParameters::getStateInformation(MemoryBlock& destData)
 {
-    ValueTree uiState{ UIState, { { "width",  pluginModel.uiWidth }, { "height", pluginModel.uiHeight } }, {} };
-    //uiState.addChild({ UIState, { { "width",  pluginModel.uiWidth }, { "height", pluginModel.uiHeight } }, {} }, -1, nullptr);
-    
-    auto paramState = parameters.copyState();
-
-    //Remove all previous UIState xml elements
-    std::vector<int> childrenToRemove;
-    for (int idx = paramState.getNumChildren() - 1; idx > -1; idx--)
+    MemoryOutputStream stream(destData, false);
+    stream.writeInt(stateMagic);
+    stream.writeShort((short)stateVersion);
+    stream.writeShort((short)numParameters);
+    for (int index = 0; index < numParameters; index++)
+        stream.writeFloat(getParameterValue(index));
+    stream.writeInt(pluginModel.uiWidth.load());
+    stream.writeInt(pluginModel.uiHeight.load());
+}
+
+void VSTParameters::setStateInformation(const void* data, int size)
+{
+    MemoryInputStream stream(data, (size_t)jmax(size, 0), false);
+    if (size < stateHeaderSize || stream.readInt() != stateMagic)
     {
-        ValueTree child = paramState.getChild(idx);
-        if (child.getType() == oldUiState || child.getType() == UIState)
-        {
-            childrenToRemove.push_back(idx);
-        }
+        setStateFromXml(data, size);
+        return;
     }
-    for (int idx = 0; idx < childrenToRemove.size(); idx++)
+
+    int version = stream.readShort();
+    if (version < 1 || version > stateVersion)
+        return;
+
+    int numSaved = stream.readShort();
+    if (numSaved < 0 || stream.getNumBytesRemaining() < numSaved * 4 + 8)
+        return;
+
+    for (int index = 0; index < numSaved; index++)
     {
-        paramState.removeChild(childrenToRemove[idx], nullptr);
+        float value = stream.readFloat();
+        if (index >= numParameters)
+            continue;
+        RangedAudioParameter* parameter = parameterSlots[index];
+        parameter->setValueNotifyingHost(parameter->convertTo0to1(value));
     }
+    updateSettingsFromParameters();
+    pluginModel.uiWidth = stream.readInt();
+    pluginModel.uiHeight = stream.readInt();
+    pluginModel.hasParamChanges = true;
+}
 
-    paramState.appendChild(uiState, nullptr);
-    std::unique_ptr<juce::XmlElement> xml(paramState.createXml());
-    String document = xml->createDocument("", false, false);
-    processor.copyXmlToBinary(*xml, destData);
+void VSTParameters::updateSettingsFromParameters()
+{
+    PluginSettings settings;
+    for (int index = 0; index < numParameters; index++)
+        setSettingValue(settings, index, getParameterValue(index));
+    pluginModel.setSettings(settings);
 }
 
-void VSTParameters::setStateInformation(const void* data, int size)
+void VSTParameters::setStateFromXml(const void* data, int size)
 {
     if (auto xmlState = processor.getXmlFromBinary(data, size))
     {
-        String document = xmlState->createDocument("", false, false);
         if (xmlState->hasTagName(parameters.state.getType()))
         {
             parameters.replaceState(juce::ValueTree::fromXml(*xmlState));
-            pluginModel.keyId = (int)*keyParameter;
-            pluginModel.holdNotes = *holdNotesParameter > 0.5 ? true : false;
-            pluginModel.transposeOctaves = (int)*octavesParameter;
-            pluginModel.shortNotation = *shortNotationParameter > 0.5 ? true : false;
-            pluginModel.chordPlacement = (int)*chordPlacementParameter;
-            pluginModel.chordFontBold = *chordFontBoldParameter > 0.5 ? true : false;
-            pluginModel.darkMode = *darkModeParameter > 0.5 ? true : false;
-            pluginModel.hasParamChanges = true;
+            updateSettingsFromParameters();
 
             //check if xmlState has UIState
             XmlElement* uiStateXml = xmlState->getChildByName(UIState);
@@ -177,6 +227,7 @@ void VSTParameters::setStateInformation(const void* data, int size)
                 pluginModel.uiWidth = uiStateXml->getAttributeValue(0).getIntValue();
                 pluginModel.uiHeight = uiStateXml->getAttributeValue(1).getIntValue();
             }
+            pluginModel.hasParamChanges = true;
         }
     }
 }
\ No newline at end of file
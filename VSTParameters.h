@@ -34,28 +34,41 @@ static String CHORD_PLACEMENT = "chordPlacement";
 static String CHORD_FONT_BOLD = "chordFontBold";
 static String DARK_MODE = "darkMode";
 
-class VSTParameters : AudioProcessorValueTreeState::Listener
+//the parameters in the order they are created, which is also their index in the processor
+enum ParameterIndex
+{
+	keyParameter,
+	holdNotesParameter,
+	octavesParameter,
+	shortNotationParameter,
+	chordPlacementParameter,
+	chordFontBoldParameter,
+	darkModeParameter,
+	numParameters
+};
+
+class VSTParameters : AudioProcessorParameter::Listener
 {
 public:
 	VSTParameters(AudioProcessor& processorRef, PluginModel& pluginModelRef);
 	~VSTParameters();
 
-	void parameterChanged(const String& parameterID, float newValue);
+	void parameterValueChanged(int parameterIndex, float newValue) override;
+	void parameterGestureChanged(int, bool) override {}
 	void getStateInformation(MemoryBlock& destData);
 	void setStateInformation(const void* data, int size);
 private:
 	void pluginModelChangedFromUI();
+	void updateSettingsFromParameters();
+	//sessions saved before the binary state
+	void setStateFromXml(const void* data, int size);
+	float getParameterValue(int index) const;
+	static float getSettingValue(const PluginSettings& settings, int index);
+	static void setSettingValue(PluginSettings& settings, int index, float value);
 
 	AudioProcessor& processor;
 	PluginModel& pluginModel;
 	juce::AudioProcessorValueTreeState parameters;
 
-	AudioParameterChoice* keyParameter;
-	std::atomic<float>* holdNotesParameter = nullptr;
-	std::atomic<float>* octavesParameter = nullptr;
-	std::atomic<float>* shortNotationParameter = nullptr;
-	std::atomic<float>* chordPlacementParameter = nullptr;
-	std::atomic<float>* chordFontBoldParameter = nullptr;
-	std::atomic<float>* darkModeParameter = nullptr;
-
+	RangedAudioParameter* parameterSlots[numParameters] = {};
 };
\ No newline at end of file